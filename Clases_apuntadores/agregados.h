@@ -0,0 +1,203 @@
+#ifndef AGREGADOS_H
+#define AGREGADOS_H
+
+#include "columnas.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Columna numérica sobre la que se calcula un agregado
+enum class CampoAgregado {
+    Ingresos,        // ingresosAnuales
+    Patrimonio,      // patrimonio
+    Deudas,          // deudas
+    FechaNacimiento  // fechaNacimiento (AAAAMMDD, el mínimo es la persona más longeva)
+};
+
+// Operación de reducción
+enum class OperacionAgregado {
+    Maximo,   // Mayor valor y primera fila que lo alcanza
+    Minimo,   // Menor valor y primera fila que lo alcanza
+    Suma,
+    Conteo,   // Filas del grupo (no lee el campo)
+    Promedio  // Suma / Conteo
+};
+
+// Claves de agrupación
+enum class AgrupacionAgregado {
+    Total,        // Una sola clave
+    Ciudad,       // Código de ciudad
+    Grupo,        // indiceGrupoConN (A, B, C, N)
+    CiudadYGrupo  // ciudad * NUM_GRUPOS + indiceGrupoConN
+};
+
+struct SolicitudAgregado {
+    OperacionAgregado operacion;
+    CampoAgregado campo;
+    AgrupacionAgregado agrupacion;
+};
+
+/**
+ * Resultado de una solicitud, con una posición por clave de agrupación.
+ *
+ * Las claves sin filas quedan con conteo 0, valor 0 y fila FILA_INVALIDA.
+ */
+struct ResultadoAgregado {
+    SolicitudAgregado solicitud;
+    std::vector<double> valor;     // Valor agregado de cada clave
+    std::vector<size_t> fila;      // Fila del máximo/mínimo (FILA_INVALIDA en las demás operaciones)
+    std::vector<uint64_t> conteo;  // Filas de cada clave
+};
+
+// Número de claves de una agrupación (Ciudad usa el tamaño de diccionarioCiudades())
+size_t numeroDeClaves(AgrupacionAgregado agrupacion);
+
+/**
+ * Calcula todas las solicitudes en un solo recorrido de las columnas.
+ *
+ * POR QUÉ: Cada consulta por ciudad o grupo es un recorrido completo; el reporte de las
+ *          opciones 5 a 10 repetía ocho veces la lectura de ciudad, grupo y las columnas
+ *          numéricas, y con millones de filas el límite es el ancho de banda de memoria.
+ * CÓMO: Antes del recorrido se resuelve, para cada solicitud, el puntero a su columna y su
+ *       tipo de clave. En cada fila se calculan una vez las cuatro claves posibles y se
+ *       actualizan los acumuladores de todas las solicitudes. Máximo y mínimo usan
+ *       comparación estricta, así que en un empate gana la primera fila, igual que las
+ *       consultas individuales; las sumas se acumulan en orden de fila.
+ * PARA QUÉ: Que un reporte con N agregados lea cada columna una sola vez.
+ *
+ * @return Un resultado por solicitud, en el mismo orden.
+ */
+std::vector<ResultadoAgregado> calcularAgregados(const PersonaColumns& columnas,
+                                                 const std::vector<SolicitudAgregado>& solicitudes);
+
+/**
+ * Reporte completo de las opciones 5 a 10 con un único recorrido.
+ *
+ * POR QUÉ: El reporte nocturno necesita todas las consultas por ciudad y por grupo.
+ * CÓMO: Pide a calcularAgregados los máximos, mínimos, conteos y promedios de todas
+ *       ellas y los imprime con el mismo formato que las consultas individuales.
+ * PARA QUÉ: Obtener el mismo resultado que ejecutar cada opción por separado,
+ *           leyendo los datos una sola vez.
+ */
+void mostrarReporteCompleto(const PersonaColumns& columnas);
+
+// Las K mejores filas de cada clave, de la mejor a la peor
+struct ResultadoTopK {
+    CampoAgregado campo;
+    AgrupacionAgregado agrupacion;
+    std::vector<std::vector<size_t>> filas; // Una lista por clave (vacía si la clave no tiene filas)
+};
+
+/**
+ * Las K filas con mayor valor de un campo, en total o por clave de agrupación.
+ *
+ * POR QUÉ: Solo había el máximo (K = 1) por país, ciudad o grupo; pedir más exigía
+ *          ordenar la colección completa.
+ * CÓMO: Cada hilo recorre su bloque con un MonticuloTopK por clave (ver top_k.h); los
+ *       montículos se combinan clave por clave. Ingresos, patrimonio y deudas ordenan de
+ *       mayor a menor; FechaNacimiento de la más antigua a la más reciente (las personas
+ *       más longevas). En un empate va primero la fila de menor índice.
+ * PARA QUÉ: "Top 100 de patrimonio por ciudad" en un recorrido con memoria
+ *           O(K x claves x hilos), sin ordenar ni copiar las filas.
+ *
+ * @param hilos Hilos a usar (0 = todos los núcleos).
+ */
+ResultadoTopK calcularTopK(const PersonaColumns& columnas, CampoAgregado campo, AgrupacionAgregado agrupacion,
+                           size_t k, unsigned hilos = 0);
+
+// Imprime cada lista del resultado: posición, ID, nombre y valor del campo
+void mostrarTopK(const PersonaColumns& columnas, const ResultadoTopK& resultado);
+
+/**
+ * Personas con un campo financiero en [minimo, maximo].
+ *
+ * POR QUÉ: "¿Cuántas personas tienen patrimonio entre X y Y?" era un recorrido completo.
+ * CÓMO: Dos búsquedas en el índice de rango del campo (ver indice_rango.h), sin leer
+ *       filas. La primera consulta de rango o percentil de cada campo construye su
+ *       índice; si no se puede (más de 2^32 - 1 filas), un recorrido repartido entre hilos.
+ * PARA QUÉ: Conteos por rango en O(log n).
+ *
+ * @param campo Ingresos, Patrimonio o Deudas (FechaNacimiento no tiene índice de rango: 0).
+ */
+size_t contarEnRango(const PersonaColumns& columnas, CampoAgregado campo, double minimo, double maximo);
+
+/**
+ * Lista las personas con el campo en [minimo, maximo], de menor a mayor valor.
+ *
+ * CÓMO: Con el índice vigente, las filas del rango ya están ordenadas por valor (en un
+ *       empate, por fila) y solo se leen esas; sin índice, las del recorrido se ordenan.
+ *
+ * @return Personas listadas.
+ */
+size_t listarEnRango(const PersonaColumns& columnas, CampoAgregado campo, double minimo, double maximo);
+
+/**
+ * Fila del percentil 'percentil' (0-100) de un campo financiero, por rango más cercano:
+ * la posición ceil(percentil / 100 x n) del orden ascendente (el percentil 0 es el mínimo).
+ *
+ * CÓMO: Lectura directa en el índice de rango; sin índice, selección con nth_element.
+ *
+ * @return La fila, o FILA_INVALIDA si no hay filas o el campo es FechaNacimiento.
+ */
+size_t filaPercentil(const PersonaColumns& columnas, CampoAgregado campo, double percentil);
+
+// Índice de PersonaColumns que usan las tres consultas anteriores con 'campo' (Ingresos, Patrimonio o Deudas)
+IndiceColumnar indiceRangoDeCampo(CampoAgregado campo);
+
+/**
+ * Personas cuyas deudas superan 'fraccion' veces su patrimonio (p. ej. 0.7 = 70 %).
+ *
+ * POR QUÉ: El filtro de riesgo compara dos columnas de la misma fila; ningún índice de
+ *          una sola columna acota esas filas.
+ * CÓMO: Un recorrido de patrimonio y deudas repartido entre hilos (16 bytes por fila).
+ */
+size_t contarDeudaSobrePatrimonio(const PersonaColumns& columnas, double fraccion);
+
+/**
+ * Estadísticas por ciudad acumuladas persona a persona, sin guardar los registros.
+ *
+ * POR QUÉ: Para planear capacidad se piden estadísticas de 500M+ personas sintéticas, que
+ *          no caben en memoria ni como vector<Persona> ni como columnas.
+ * CÓMO: Cada persona generada se pasa a agregar() y se descarta. Se guardan solo la suma
+ *       de patrimonio y los conteos por (ciudad, grupo) y, por ciudad, el mayor patrimonio
+ *       con el ID y los códigos del nombre de su dueño. combinar() une el acumulado de un
+ *       tramo posterior: el máximo solo cambia con un valor estrictamente mayor, así que en
+ *       un empate gana la persona de menor índice, como en las consultas sobre la colección.
+ * PARA QUÉ: Calcular lo de calcularPromedioPatrimonio, calcularGrupoMayorPorCiudad y
+ *           buscarMayoresPatrimonioPorCiudad con memoria O(ciudades x grupos) para cualquier n.
+ */
+struct AgregadoEnFlujo {
+    // Persona con el mayor patrimonio de una ciudad (id 0 = ninguna todavía)
+    struct Maximo {
+        double patrimonio;
+        uint64_t id;
+        CodigoCadena nombre;
+        CodigoCadena apellido;
+    };
+
+    uint64_t personas;                   // Personas agregadas
+    std::vector<double> sumaPatrimonio;  // Por ciudad
+    std::vector<uint64_t> conteo;        // Por ciudad * NUM_GRUPOS + indiceGrupoConN
+    std::vector<Maximo> mayorPatrimonio; // Por ciudad
+
+    // Acumuladores en cero para las ciudades de diccionarioCiudades()
+    AgregadoEnFlujo();
+
+    void agregar(uint64_t id, CodigoCadena nombre, CodigoCadena apellido, size_t ciudad, char grupo,
+                 double patrimonio) {
+        ++personas;
+        sumaPatrimonio[ciudad] += patrimonio;
+        conteo[ciudad * NUM_GRUPOS + indiceGrupoConN(grupo)]++;
+        Maximo& mayor = mayorPatrimonio[ciudad];
+        if (mayor.id == 0 || patrimonio > mayor.patrimonio) mayor = Maximo{patrimonio, id, nombre, apellido};
+    }
+
+    // Suma el acumulado de personas posteriores a las de este
+    void combinar(const AgregadoEnFlujo& posterior);
+};
+
+// Imprime el promedio, el grupo mayor y el mayor patrimonio por ciudad con el formato de
+// las consultas individuales
+void mostrarAgregadoEnFlujo(const AgregadoEnFlujo& agregado);
+
+#endif // AGREGADOS_H
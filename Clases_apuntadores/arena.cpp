@@ -0,0 +1,36 @@
+#include "arena.h"
+#include <algorithm>  // std::min
+#include <new>        // std::bad_alloc
+#include <sys/mman.h> // mmap, munmap, madvise
+#include <unistd.h>   // sysconf
+
+ArenaMonotona::ArenaMonotona(size_t bytesPorBloque) : bytesPorBloque_(bytesPorBloque) {}
+
+ArenaMonotona::~ArenaMonotona() {
+    for (const Bloque& bloque : bloques_) munmap(bloque.inicio, bloque.tamano);
+}
+
+void* ArenaMonotona::reservar(size_t bytes, size_t alineacion) {
+    if (bytes == 0) bytes = 1;
+    const size_t desfase = reinterpret_cast<size_t>(actual_) & (alineacion - 1);
+    char* inicio = actual_ + (desfase ? alineacion - desfase : 0);
+    if (!actual_ || inicio > fin_ || static_cast<size_t>(fin_ - inicio) < bytes) {
+        // Bloque nuevo; mmap devuelve memoria alineada a página, suficiente para cualquier T
+        const size_t pagina = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        // El primero, lo pedido; los siguientes, el doble del anterior hasta bytesPorBloque_
+        size_t tamano = bloques_.empty() ? 0 : std::min(bloques_.back().tamano * 2, bytesPorBloque_);
+        if (tamano < bytes) tamano = bytes;
+        tamano = (tamano + pagina - 1) / pagina * pagina;
+        void* memoria = mmap(nullptr, tamano, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (memoria == MAP_FAILED) throw std::bad_alloc();
+#ifdef MADV_HUGEPAGE
+        madvise(memoria, tamano, MADV_HUGEPAGE); // Solo un consejo; se ignora si no hay páginas grandes
+#endif
+        bloques_.push_back(Bloque{static_cast<char*>(memoria), tamano});
+        inicio = static_cast<char*>(memoria);
+        fin_ = inicio + tamano;
+    }
+    actual_ = inicio + bytes;
+    usados_ += bytes;
+    return inicio;
+}
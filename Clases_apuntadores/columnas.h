@@ -0,0 +1,283 @@
+#ifndef COLUMNAS_H
+#define COLUMNAS_H
+
+#include "diccionario.h"
+#include "fecha.h"
+#include "indice_ciudad_grupo.h"
+#include "indice_id.h"
+#include "indice_rango.h"
+#include "mapa_bits.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * Columna de solo lectura para las consultas: arreglo propio o vista sobre memoria externa.
+ *
+ * POR QUÉ: Las columnas se llenan fila a fila al construirlas desde vector<Persona>, pero
+ *          al cargar una instantánea (ver instantanea.h) ya están en el archivo mapeado
+ *          y copiarlas a un std::vector sería volver a pagar la carga.
+ * CÓMO: Guarda un puntero y una longitud. push_back()/reserve() escriben en un
+ *       std::vector propio y actualizan el puntero; enlazar() apunta a memoria ajena
+ *       (que debe vivir mientras exista la columna) y descarta el vector propio.
+ * PARA QUÉ: Que las consultas lean igual una columna construida o una mapeada.
+ */
+template <typename T>
+class Columna {
+public:
+    Columna() : datos(nullptr), cantidad(0) {}
+    Columna(const Columna& otra) : propios(otra.propios) { copiarPuntero(otra); }
+    Columna(Columna&& otra) noexcept : propios(std::move(otra.propios)) { copiarPuntero(otra); otra.vaciar(); }
+    Columna& operator=(const Columna& otra) {
+        if (this != &otra) { propios = otra.propios; copiarPuntero(otra); }
+        return *this;
+    }
+    Columna& operator=(Columna&& otra) noexcept {
+        if (this != &otra) { propios = std::move(otra.propios); copiarPuntero(otra); otra.vaciar(); }
+        return *this;
+    }
+
+    void reserve(size_t n) { propios.reserve(n); sincronizar(); }
+    void push_back(const T& valor) { propios.push_back(valor); sincronizar(); }
+
+    // Usa [inicio, inicio + n) sin copiarlo
+    void enlazar(const T* inicio, size_t n) {
+        std::vector<T>().swap(propios);
+        datos = inicio;
+        cantidad = n;
+    }
+
+    size_t size() const { return cantidad; }
+    bool empty() const { return cantidad == 0; }
+    const T* data() const { return datos; }
+    const T* begin() const { return datos; }
+    const T* end() const { return datos + cantidad; }
+    const T& operator[](size_t i) const { return datos[i]; }
+
+private:
+    void sincronizar() { datos = propios.data(); cantidad = propios.size(); }
+    void vaciar() { datos = nullptr; cantidad = 0; }
+    // Tras copiar o mover 'propios': apunta al vector propio, o a la misma vista que 'otra'
+    void copiarPuntero(const Columna& otra) {
+        if (otra.datos == otra.propios.data() || !propios.empty()) sincronizar();
+        else { datos = otra.datos; cantidad = otra.cantidad; }
+    }
+
+    std::vector<T> propios;  // Datos propios (vacío si es una vista)
+    const T* datos;          // Primer elemento (propio o ajeno)
+    size_t cantidad;         // Número de elementos
+};
+
+/**
+ * Índice que se construye en la primera consulta que lo pide.
+ *
+ * POR QUÉ: Cargar una instantánea es un mmap de milisegundos, pero construir todos los
+ *          índices al cargar (o al generar) costaba más que la carga misma, aunque la
+ *          sesión no usara ninguno.
+ * CÓMO: obtener(construir) devuelve el índice; la primera llamada lo construye bajo un
+ *       mutex y publica una bandera atómica, así que las siguientes solo leen la bandera.
+ *       Copiar o mover el dueño copia o mueve el índice tal como esté (construido o no).
+ * PARA QUÉ: Pagar cada índice solo si se usa, sin que las consultas dejen de ser const.
+ */
+template <typename Indice>
+class IndicePerezoso {
+public:
+    IndicePerezoso() : listo_(false) {}
+    IndicePerezoso(const IndicePerezoso& otro) : listo_(false) { *this = otro; }
+    IndicePerezoso(IndicePerezoso&& otro) : listo_(false) { *this = std::move(otro); }
+    IndicePerezoso& operator=(const IndicePerezoso& otro) {
+        if (this == &otro) return *this;
+        std::lock(mutex_, otro.mutex_);
+        std::lock_guard<std::mutex> propio(mutex_, std::adopt_lock), ajeno(otro.mutex_, std::adopt_lock);
+        indice_ = otro.indice_;
+        listo_.store(otro.listo_.load(std::memory_order_relaxed), std::memory_order_release);
+        return *this;
+    }
+    IndicePerezoso& operator=(IndicePerezoso&& otro) {
+        if (this == &otro) return *this;
+        std::lock(mutex_, otro.mutex_);
+        std::lock_guard<std::mutex> propio(mutex_, std::adopt_lock), ajeno(otro.mutex_, std::adopt_lock);
+        indice_ = std::move(otro.indice_);
+        listo_.store(otro.listo_.load(std::memory_order_relaxed), std::memory_order_release);
+        otro.indice_ = Indice();
+        otro.listo_.store(false, std::memory_order_release);
+        return *this;
+    }
+
+    // El índice, construido con construir(Indice&) si todavía no lo estaba
+    template <typename Construir>
+    const Indice& obtener(Construir construir) const {
+        if (!listo_.load(std::memory_order_acquire)) {
+            std::lock_guard<std::mutex> bloqueo(mutex_);
+            if (!listo_.load(std::memory_order_relaxed)) {
+                construir(indice_);
+                listo_.store(true, std::memory_order_release);
+            }
+        }
+        return indice_;
+    }
+
+    // true si el índice ya está construido
+    bool listo() const { return listo_.load(std::memory_order_acquire); }
+
+    // Descarta el índice; la próxima consulta lo vuelve a construir
+    void invalidar() {
+        std::lock_guard<std::mutex> bloqueo(mutex_);
+        indice_ = Indice();
+        listo_.store(false, std::memory_order_release);
+    }
+
+private:
+    mutable Indice indice_;
+    mutable std::atomic<bool> listo_;
+    mutable std::mutex mutex_;
+};
+
+// Índices de PersonaColumns que se construyen en la primera consulta que los pide
+enum class IndiceColumnar { CiudadGrupo, MapasBits, RangoIngresos, RangoPatrimonio, RangoDeudas };
+
+// Nombre de cada índice para registrar su construcción (p. ej. "Construir mapas de bits")
+extern const char* const NOMBRES_INDICE_COLUMNAR[];
+
+/**
+ * Almacén columnar (struct-of-arrays) de personas.
+ *
+ * POR QUÉ: Cada Persona ocupa ~190 bytes (cinco std::string), pero casi todas las
+ *          consultas leen un solo double o un char. Recorrer un vector<Persona> arrastra
+ *          por la caché todos los campos de cada registro.
+ * CÓMO: Cada campo vive en su propio arreglo contiguo; la fila i de todos los arreglos
+ *       es la persona i. Nombre, apellido y ciudad se guardan como códigos de sus
+ *       diccionarios y la fecha como entero AAAAMMDD, que se ordena cronológicamente.
+ * PARA QUÉ: Que un recorrido sobre patrimonio de 10M personas lea ~80 MB en lugar de ~2 GB.
+ */
+struct PersonaColumns {
+    // Columnas de identificación (solo se leen al imprimir o buscar por ID)
+    Columna<uint64_t> id;                 // Identificador numérico (cédula)
+    Columna<CodigoCadena> nombre;         // Código en diccionarioNombres()
+    Columna<CodigoCadena> apellido;       // Código en diccionarioApellidos()
+    Columna<FechaAAAAMMDD> fechaNacimiento; // Fecha en formato AAAAMMDD
+
+    // Columnas usadas por las consultas
+    Columna<uint8_t> ciudad;              // Código en diccionarioCiudades()
+    Columna<double> ingresosAnuales;      // Ingresos anuales en pesos colombianos
+    Columna<double> patrimonio;           // Patrimonio total (activos)
+    Columna<double> deudas;               // Deudas totales (pasivos)
+    Columna<uint8_t> declaranteRenta;     // 1 si es declarante de renta
+    Columna<char> grupoDeclaracion;       // Grupo de declaración (A, B, C o N)
+
+    IndiceID indiceID;                    // ID -> fila (acceso directo si los IDs son consecutivos)
+    std::shared_ptr<const void> almacen;  // Mantiene vivo el archivo mapeado si las columnas son vistas
+
+    size_t size() const { return id.size(); }
+    bool empty() const { return id.empty(); }
+    void reservar(size_t n);
+
+    // Reconstruye indiceID a partir de la columna id; llamar después de llenar las columnas
+    void indexarIDs();
+
+    // (ciudad, grupo) -> filas, para consultas filtradas; se construye en la primera llamada
+    const IndiceCiudadGrupo& indiceCiudadGrupo() const;
+
+    // Mapas de bits por grupo, ciudad y declarante, para conteos; se construyen en la primera llamada
+    const IndiceMapasBits& mapasBits() const;
+
+    // Filas ordenadas por ingresosAnuales, patrimonio o deudas, para rangos y percentiles;
+    // cada una se construye en la primera llamada (un ordenamiento de la columna)
+    const IndiceRango& rangoIngresos() const;
+    const IndiceRango& rangoPatrimonio() const;
+    const IndiceRango& rangoDeudas() const;
+
+    // Los mismos índices por nombre. Las consultas medidas corren en un proceso hijo
+    // (medir_memoria_funcion_kb) y lo que construyan se pierde con él: el menú y el modo
+    // guion los construyen antes en el proceso principal y registran ese costo aparte.
+    bool indiceListo(IndiceColumnar indice) const;
+    void construirIndice(IndiceColumnar indice) const;
+
+private:
+    IndicePerezoso<IndiceCiudadGrupo> indiceCiudadGrupo_;
+    IndicePerezoso<IndiceMapasBits> mapasBits_;
+    IndicePerezoso<IndiceRango> rangoIngresos_;
+    IndicePerezoso<IndiceRango> rangoPatrimonio_;
+    IndicePerezoso<IndiceRango> rangoDeudas_;
+};
+
+// Número de grupos de declaración contando a los no declarantes (A, B, C y N)
+const size_t NUM_GRUPOS = 4;
+
+// Letra de cada índice devuelto por indiceGrupoConN
+extern const char LETRAS_GRUPO[NUM_GRUPOS];
+
+// Índice 0-3 para los grupos A, B y C; cualquier otro valor cuenta como N (3)
+int indiceGrupoConN(char grupo);
+
+// --- Consultas columnares (mismo resultado que sus equivalentes sobre vector<Persona>) ---
+
+// Fila de la persona con el ID dado (O(1) por indiceID), o FILA_INVALIDA
+size_t buscarPorID(const PersonaColumns& columnas, uint64_t id);
+
+// Fila de la persona con mayor patrimonio (primera en caso de empate)
+size_t buscarMayorPatrimonio(const PersonaColumns& columnas);
+
+// Fila de la persona con mayor deuda (primera en caso de empate)
+size_t buscarMayorDeuda(const PersonaColumns& columnas);
+
+// Fila de la persona con la fecha de nacimiento más antigua
+size_t buscarPersonaMasLongevaConCondicion(const PersonaColumns& columnas);
+
+void buscarMayoresPatrimonioPorCiudad(const PersonaColumns& columnas);
+void buscarMayoresPatrimonioPorGrupo(const PersonaColumns& columnas);
+void buscarMayoresDeudasPorCiudad(const PersonaColumns& columnas);
+void buscarMayoresDeudasPorGrupo(const PersonaColumns& columnas);
+void mostrarPersonasMasLongevaPorCiudad(const PersonaColumns& columnas);
+void listarPersonasGrupo(const PersonaColumns& columnas, char grupoDeclaracion, int* contador);
+
+/**
+ * Lista las personas de un grupo de declaración nacidas en una ciudad.
+ *
+ * POR QUÉ: Preguntas como "todo el grupo B de Cali" no deberían recorrer el país entero.
+ * CÓMO: Lee la lista de filas de (ciudad, grupo) en indiceCiudadGrupo; sin índice
+ *       vigente recorre las columnas ciudad y grupo.
+ * PARA QUÉ: Que el costo dependa de las personas que cumplen el filtro y no de n.
+ *
+ * @param ciudad Código en diccionarioCiudades().
+ * @param contador Se le suma el número de personas listadas.
+ */
+void listarPersonasCiudadGrupo(const PersonaColumns& columnas, CodigoCadena ciudad, char grupoDeclaracion,
+                               int* contador);
+void calcularGrupoMayorPorCiudad(const PersonaColumns& columnas);
+void calcularPromedioPatrimonio(const PersonaColumns& columnas);
+
+// Filtro de contarPersonas; -1 en un campo = no filtra por él
+struct FiltroConteo {
+    int grupo;       // indiceGrupoConN (0-3)
+    int ciudad;      // Código en diccionarioCiudades()
+    int declarante;  // 1 = solo declarantes, 0 = solo no declarantes
+};
+
+/**
+ * Número de personas que cumplen todas las condiciones del filtro.
+ *
+ * POR QUÉ: Contar un grupo o un grupo en una ciudad no requiere listar ni leer las filas.
+ * CÓMO: AND de los mapas de bits de las condiciones y popcount (ver mapa_bits.h); sin
+ *       mapas vigentes recorre las columnas con las mismas condiciones.
+ * PARA QUÉ: Conteos combinados en microsegundos sobre 10M filas.
+ */
+size_t contarPersonas(const PersonaColumns& columnas, const FiltroConteo& filtro);
+
+// Imprime cuántas personas hay en cada grupo (A, B, C, N), cuántas declaran y el total de declarantes
+void mostrarConteoPorGrupo(const PersonaColumns& columnas);
+
+/**
+ * Muestra toda la información de la fila indicada.
+ *
+ * POR QUÉ: Las búsquedas columnares devuelven filas, no objetos Persona.
+ * CÓMO: Lee cada columna en la posición 'fila' y la imprime con el mismo formato que Persona::mostrar().
+ * PARA QUÉ: Visualizar el resultado de una consulta sin reconstruir la Persona.
+ */
+void mostrarFila(const PersonaColumns& columnas, size_t fila);
+
+#endif // COLUMNAS_H
@@ -0,0 +1,90 @@
+#ifndef DICCIONARIO_H
+#define DICCIONARIO_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Código entero que reemplaza a un texto repetido (posición en su diccionario)
+typedef uint32_t CodigoCadena;
+
+/**
+ * Diccionario de cadenas internadas (string interning).
+ *
+ * POR QUÉ: Nombres, apellidos y ciudades salen de tablas fijas, pero cada Persona
+ *          guardaba su propia copia en un std::string: con 10M registros son decenas
+ *          de millones de reservas de memoria para unos pocos cientos de textos distintos.
+ * CÓMO: Cada texto distinto se guarda una sola vez y recibe un código consecutivo
+ *       (0, 1, 2...). El registro guarda el código y el texto solo se consulta al imprimir.
+ *       Los textos viven en segmentos que nunca se mueven (cada uno del doble del anterior)
+ *       y el número de textos se publica después de escribir el nuevo, así que texto() y
+ *       size() leen sin bloqueo, también desde los hilos que formatean un listado. El
+ *       mutex protege solo las inserciones y el mapa texto -> código.
+ * PARA QUÉ: Registros más pequeños y agrupaciones por ciudad que indexan un arreglo
+ *           con el código en lugar de calcular el hash de un string.
+ */
+class DiccionarioCadenas {
+public:
+    DiccionarioCadenas();
+    ~DiccionarioCadenas();
+
+    // Crea el diccionario con 'iniciales' en los códigos 0..n-1, en el mismo orden (también los repetidos)
+    explicit DiccionarioCadenas(const std::vector<std::string>& iniciales);
+
+    DiccionarioCadenas(const DiccionarioCadenas&) = delete;
+    DiccionarioCadenas& operator=(const DiccionarioCadenas&) = delete;
+
+    // Código de 'texto'; si no existe lo agrega al final
+    CodigoCadena codificar(const std::string& texto);
+
+    // Busca el código de 'texto' sin agregarlo; false si no está registrado
+    bool buscar(const std::string& texto, CodigoCadena& codigo) const;
+
+    // Texto asociado a 'codigo' < size(), sin bloqueo (la referencia sigue siendo válida aunque se agreguen más)
+    const std::string& texto(CodigoCadena codigo) const {
+        size_t segmento, posicion;
+        ubicar(codigo, segmento, posicion);
+        return segmentos[segmento].load(std::memory_order_acquire)[posicion];
+    }
+
+    // Número de textos distintos registrados, sin bloqueo
+    size_t size() const { return cantidad.load(std::memory_order_acquire); }
+
+private:
+    static const unsigned BITS_PRIMER_SEGMENTO = 6;                     // El segmento 0 guarda 64 textos
+    static const unsigned NUM_SEGMENTOS = 33 - BITS_PRIMER_SEGMENTO;    // Alcanzan para los 2^32 códigos
+
+    // Segmento y posición del código: el segmento k guarda los códigos [64 (2^k - 1), 64 (2^(k+1) - 1))
+    static void ubicar(size_t codigo, size_t& segmento, size_t& posicion) {
+        const size_t desplazado = codigo + (size_t(1) << BITS_PRIMER_SEGMENTO);
+        segmento = static_cast<size_t>(63 - __builtin_clzll(desplazado)) - BITS_PRIMER_SEGMENTO;
+        posicion = desplazado - (size_t(1) << (segmento + BITS_PRIMER_SEGMENTO));
+    }
+
+    // Escribe 'texto' con el código size() y lo publica; llamar con el mutex tomado
+    CodigoCadena agregar(const std::string& texto);
+
+    std::atomic<std::string*> segmentos[NUM_SEGMENTOS];    // Código -> texto (los segmentos nunca se mueven)
+    std::atomic<size_t> cantidad;                          // Textos publicados
+    std::unordered_map<std::string, CodigoCadena> codigos; // Texto -> código
+    mutable std::mutex mutex;                              // Protege las inserciones y codigos
+};
+
+/**
+ * Diccionarios globales de los campos de texto de Persona.
+ *
+ * POR QUÉ: Los códigos solo tienen sentido junto al diccionario que los asignó.
+ * CÓMO: Se definen en generador.cpp y se precargan con sus tablas (ciudadesColombia,
+ *       nombres femeninos + masculinos, todas las combinaciones de dos apellidos),
+ *       de modo que el código de cada valor es su posición en esas tablas.
+ * PARA QUÉ: Generar personas calculando el código sin bloquear el mutex.
+ */
+DiccionarioCadenas& diccionarioCiudades();
+DiccionarioCadenas& diccionarioNombres();
+DiccionarioCadenas& diccionarioApellidos();
+
+#endif // DICCIONARIO_H
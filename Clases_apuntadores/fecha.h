@@ -0,0 +1,32 @@
+#ifndef FECHA_H
+#define FECHA_H
+
+#include <cstdint>
+#include <string>
+
+/**
+ * Fecha de nacimiento empaquetada como entero AAAAMMDD (p. ej. 19600101).
+ *
+ * POR QUÉ: Guardar la fecha como texto "D/M/AAAA" cuesta un std::string por persona y,
+ *          al compararla, no respeta el orden cronológico ("10/1/2000" < "2/1/1960").
+ * CÓMO: anio * 10000 + mes * 100 + dia cabe en 32 bits y el orden de los enteros
+ *       coincide con el orden de las fechas. El texto solo se arma al imprimir.
+ * PARA QUÉ: Que la persona más longeva sea un mínimo entero, sin copias de cadenas.
+ */
+typedef uint32_t FechaAAAAMMDD;
+
+// Fecha más antigua que puede generarse (1/1/1960)
+const FechaAAAAMMDD FECHA_MAS_ANTIGUA = 19600101;
+
+// Empaqueta día, mes y año en AAAAMMDD
+inline FechaAAAAMMDD componerFecha(int dia, int mes, int anio) {
+    return static_cast<FechaAAAAMMDD>(anio * 10000 + mes * 100 + dia);
+}
+
+// Convierte una fecha "D/M/AAAA" al entero AAAAMMDD (0 si el texto no es válido)
+FechaAAAAMMDD fechaAAAAMMDD(const std::string& fecha);
+
+// Convierte AAAAMMDD de vuelta al formato "D/M/AAAA" usado al imprimir
+std::string formatearFecha(FechaAAAAMMDD fecha);
+
+#endif // FECHA_H
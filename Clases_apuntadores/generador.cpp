@@ -1,4 +1,6 @@
 #include "generador.h"
+#include "paralelo.h" // ejecutarEnBloques, reducirEnParalelo
+#include "salida.h"   // escribirRegistros, hilosSalida
 #include <algorithm> // std::find_if
 #include <cstdlib>   // rand(), srand()
 #include <ctime>     // time()
@@ -39,19 +41,79 @@ const std::vector<std::string> ciudadesColombia = {
     "Sincelejo",   "Valledupar", "Montería",    "Popayán",       "Tunja"};
 
 const std::vector<std::string> &ciudadesColombiaRef = ciudadesColombia;
+
+// Todas las combinaciones "Apellido1 Apellido2"; el código es primero * N + segundo
+static std::vector<std::string> combinarApellidos() {
+  std::vector<std::string> compuestos;
+  compuestos.reserve(apellidos.size() * apellidos.size());
+  for (const std::string& primero : apellidos) {
+    for (const std::string& segundo : apellidos) {
+      compuestos.push_back(primero + " " + segundo);
+    }
+  }
+  return compuestos;
+}
+
+// Nombres femeninos seguidos de los masculinos
+static std::vector<std::string> combinarNombres() {
+  std::vector<std::string> nombres(nombresFemeninos);
+  nombres.insert(nombres.end(), nombresMasculinos.begin(), nombresMasculinos.end());
+  return nombres;
+}
+
+/**
+ * Implementación de los diccionarios globales.
+ *
+ * POR QUÉ: Los códigos que calcula generarPersona() deben coincidir con los del diccionario.
+ * CÓMO: Cada diccionario se crea la primera vez que se usa, precargado con su tabla.
+ * PARA QUÉ: Código de ciudad = posición en ciudadesColombia, y así con nombres y apellidos.
+ */
+DiccionarioCadenas& diccionarioCiudades() {
+  static DiccionarioCadenas diccionario(ciudadesColombia);
+  return diccionario;
+}
+
+DiccionarioCadenas& diccionarioNombres() {
+  static DiccionarioCadenas diccionario(combinarNombres());
+  return diccionario;
+}
+
+DiccionarioCadenas& diccionarioApellidos() {
+  static DiccionarioCadenas diccionario(combinarApellidos());
+  return diccionario;
+}
+
+// Códigos de los valores de las tablas (mismo orden con el que se precargan los diccionarios)
+static CodigoCadena codigoNombreFemenino(size_t i) { return static_cast<CodigoCadena>(i); }
+static CodigoCadena codigoNombreMasculino(size_t i) { return static_cast<CodigoCadena>(nombresFemeninos.size() + i); }
+static CodigoCadena codigoApellido(size_t primero, size_t segundo) { return static_cast<CodigoCadena>(primero * apellidos.size() + segundo); }
+static CodigoCadena codigoCiudad(size_t i) { return static_cast<CodigoCadena>(i); }
 /**
  * Implementación de generarFechaNacimiento.
  *
  * POR QUÉ: Simular fechas de nacimiento realistas.
- * CÓMO: Día (1-28), mes (1-12), año (1960-2009).
+ * CÓMO: Día (1-28), mes (1-12), año (1960-2009), empaquetados como AAAAMMDD.
  * PARA QUÉ: Atributo fechaNacimiento de Persona.
  */
-std::string generarFechaNacimiento() {
+FechaAAAAMMDD generarFechaNacimiento() {
   int dia = 1 + rand() % 28;     // Día: 1 a 28 (evita problemas con meses)
   int mes = 1 + rand() % 12;     // Mes: 1 a 12
   int anio = 1960 + rand() % 50; // Año: 1960 a 2009
-  return std::to_string(dia) + "/" + std::to_string(mes) + "/" +
-         std::to_string(anio);
+  return componerFecha(dia, mes, anio);
+}
+
+/**
+ * Implementación de generarFechaNacimiento con generador basado en contador.
+ *
+ * POR QUÉ: Poder generar fechas desde varios hilos sin compartir estado.
+ * CÓMO: Mismo rango que la versión con rand(): día 1-28, mes 1-12, año 1960-2009.
+ * PARA QUÉ: Atributo fechaNacimiento en la generación paralela.
+ */
+FechaAAAAMMDD generarFechaNacimiento(GeneradorContador& gen) {
+  int dia = 1 + gen.enteroMenorQue(28);
+  int mes = 1 + gen.enteroMenorQue(12);
+  int anio = 1960 + gen.enteroMenorQue(50);
+  return componerFecha(dia, mes, anio);
 }
 
 /**
@@ -61,9 +123,9 @@ std::string generarFechaNacimiento() {
  * CÓMO: Contador estático que inicia en 1000000000 y se incrementa.
  * PARA QUÉ: Simular números de cédula.
  */
-int generarID() {
-  static long contador = 1000000000; // Inicia en 1,000,000,000
-  return contador++;                 // Convierte a string e incrementa
+uint64_t generarID() {
+  static uint64_t contador = 1000000000; // Inicia en 1,000,000,000
+  return contador++;                     // Devuelve y luego incrementa
 }
 
 /**
@@ -99,21 +161,21 @@ Persona generarPersona() {
     // Decide si es hombre o mujer
     bool esHombre = rand() % 2;
     
-    // Selecciona nombre según género
-    std::string nombre = esHombre ? 
-        nombresMasculinos[rand() % nombresMasculinos.size()] :
-        nombresFemeninos[rand() % nombresFemeninos.size()];
+    // Selecciona nombre según género (solo su código en el diccionario)
+    CodigoCadena nombre = esHombre ? 
+        codigoNombreMasculino(rand() % nombresMasculinos.size()) :
+        codigoNombreFemenino(rand() % nombresFemeninos.size());
     
     // Construye apellido compuesto (dos apellidos aleatorios)
-    std::string apellido = apellidos[rand() % apellidos.size()];
-    apellido += " ";
-    apellido += apellidos[rand() % apellidos.size()];
+    size_t primerApellido = rand() % apellidos.size();
+    size_t segundoApellido = rand() % apellidos.size();
+    CodigoCadena apellido = codigoApellido(primerApellido, segundoApellido);
     
     // Genera los demás atributos
-    long id = generarID();
+    uint64_t id = generarID();
 
-    std::string ciudad = ciudadesColombia[rand() % ciudadesColombia.size()];
-    std::string fecha = generarFechaNacimiento();
+    CodigoCadena ciudad = codigoCiudad(rand() % ciudadesColombia.size());
+    FechaAAAAMMDD fecha = generarFechaNacimiento();
     
     // Genera datos financieros realistas
     double ingresos = randomDouble(10000000, 500000000);   // 10M a 500M COP
@@ -122,7 +184,7 @@ Persona generarPersona() {
     bool declarante = (ingresos > 50000000) && (rand() % 100 > 30); // Probabilidad 70% si ingresos > 50M
     char grupoDeclaracion = grupoRenta(id%100, declarante);
     
-    return Persona(nombre, apellido, std::to_string(id), ciudad, fecha, ingresos, patrimonio, deudas, declarante, grupoDeclaracion);
+    return Persona(nombre, apellido, id, ciudad, fecha, ingresos, patrimonio, deudas, declarante, grupoDeclaracion);
 }
 
 /**
@@ -132,8 +194,8 @@ Persona generarPersona() {
  * CÓMO: Reservando espacio y agregando n personas generadas.
  * PARA QUÉ: Crear datasets para pruebas.
  */
-std::vector<Persona> generarColeccion(int n) {
-  std::vector<Persona> personas;
+ColeccionPersonas generarColeccion(int n) {
+  ColeccionPersonas personas;
   personas.reserve(n); // Reserva espacio para n personas (eficiencia)
 
   for (int i = 0; i < n; ++i) {
@@ -143,26 +205,162 @@ std::vector<Persona> generarColeccion(int n) {
   return personas;
 }
 
+/**
+ * Implementación de generarPersona determinista.
+ *
+ * POR QUÉ: Generar la persona 'indice' sin depender de rand() ni de estado estático.
+ * CÓMO: Mismas reglas que generarPersona(), tomando cada valor de un GeneradorContador
+ *       con clave (semilla, indice). El ID se deriva del índice, no de un contador global.
+ * PARA QUÉ: Generación paralela reproducible.
+ */
+Persona generarPersona(uint64_t semilla, uint64_t indice) {
+    GeneradorContador gen(semilla, indice);
+
+    // Decide si es hombre o mujer
+    bool esHombre = gen.enteroMenorQue(2);
+
+    // Selecciona nombre según género (solo su código en el diccionario)
+    CodigoCadena nombre = esHombre ?
+        codigoNombreMasculino(gen.enteroMenorQue(nombresMasculinos.size())) :
+        codigoNombreFemenino(gen.enteroMenorQue(nombresFemeninos.size()));
+
+    // Construye apellido compuesto (dos apellidos aleatorios)
+    size_t primerApellido = gen.enteroMenorQue(apellidos.size());
+    size_t segundoApellido = gen.enteroMenorQue(apellidos.size());
+    CodigoCadena apellido = codigoApellido(primerApellido, segundoApellido);
+
+    // El ID es secuencial según la posición en el conjunto
+    uint64_t id = 1000000000ULL + indice;
+
+    CodigoCadena ciudad = codigoCiudad(gen.enteroMenorQue(ciudadesColombia.size()));
+    FechaAAAAMMDD fecha = generarFechaNacimiento(gen);
+
+    // Genera datos financieros realistas
+    double ingresos = gen.uniforme(10000000, 500000000);   // 10M a 500M COP
+    double patrimonio = gen.uniforme(0, 2000000000);       // 0 a 2,000M COP
+    double deudas = gen.uniforme(0, patrimonio * 0.7);     // Deudas hasta el 70% del patrimonio
+    bool declarante = (ingresos > 50000000) && (gen.enteroMenorQue(100) > 30); // Probabilidad 70% si ingresos > 50M
+    char grupoDeclaracion = grupoRenta(id%100, declarante);
+
+    return Persona(nombre, apellido, id, ciudad, fecha, ingresos, patrimonio, deudas, declarante, grupoDeclaracion);
+}
+
+/**
+ * Implementación de generarColeccionParalela.
+ *
+ * POR QUÉ: Generar n personas usando todos los núcleos.
+ * CÓMO: Se reserva el vector completo con personas vacías y cada hilo sobrescribe
+ *       (por movimiento) su bloque contiguo con generarPersona(semilla, i).
+ * PARA QUÉ: Crear datasets grandes en una fracción del tiempo, idénticos para
+ *           cualquier número de hilos.
+ */
+ColeccionPersonas generarColeccionParalela(int n, uint64_t semilla, unsigned hilos) {
+  if (n <= 0) return ColeccionPersonas();
+
+  // Relleno con códigos 0 (no agrega "" a los diccionarios); se sobrescribe por bloques
+  const CodigoCadena sinCodigo = 0;
+  ColeccionPersonas personas(n, Persona(sinCodigo, sinCodigo, 0, sinCodigo, 0, 0.0, 0.0, 0.0, false, 'N'));
+
+  ejecutarEnBloques(personas.size(), hilos,
+      [&personas, semilla](size_t inicio, size_t fin, unsigned) {
+        for (size_t i = inicio; i < fin; ++i) {
+          personas[i] = generarPersona(semilla, i);
+        }
+      });
+
+  return personas;
+}
+
+// Cada hilo agrega su tramo de índices en su propio AgregadoEnFlujo; los tramos se combinan
+// en orden, así que el resultado es el de las consultas sobre generarColeccionParalela(n, semilla)
+AgregadoEnFlujo generarYAgregar(uint64_t n, uint64_t semilla, unsigned hilos) {
+  return reducirEnParalelo(static_cast<size_t>(n), hilos, AgregadoEnFlujo(),
+      [semilla](size_t inicio, size_t fin, AgregadoEnFlujo& parcial) {
+          for (size_t i = inicio; i < fin; ++i) {
+              const Persona p = generarPersona(semilla, i);
+              parcial.agregar(p.getId(), p.getCodigoNombre(), p.getCodigoApellido(), p.getCodigoCiudad(),
+                              p.getGrupoDeclaracion(), p.getPatrimonio());
+          }
+      },
+      [](AgregadoEnFlujo& acumulado, const AgregadoEnFlujo& parcial) { acumulado.combinar(parcial); });
+}
+
+/**
+ * Implementación de construirColumnas.
+ *
+ * POR QUÉ: Las consultas columnares necesitan los datos separados por campo.
+ * CÓMO: Un solo recorrido que reparte cada atributo en su columna; los códigos de
+ *       diccionario y la fecha AAAAMMDD se copian tal cual.
+ * PARA QUÉ: Pagar la conversión una vez y luego consultar solo las columnas necesarias.
+ */
+PersonaColumns construirColumnas(const ColeccionPersonas* personas) {
+  PersonaColumns columnas;
+  if (!personas) return columnas;
+  columnas.reservar(personas->size());
+
+  for (const Persona& p : *personas) {
+    columnas.id.push_back(p.getId());
+    columnas.nombre.push_back(p.getCodigoNombre());
+    columnas.apellido.push_back(p.getCodigoApellido());
+    columnas.fechaNacimiento.push_back(p.getFechaNacimiento());
+    columnas.ciudad.push_back(static_cast<uint8_t>(p.getCodigoCiudad()));
+    columnas.ingresosAnuales.push_back(p.getIngresosAnuales());
+    columnas.patrimonio.push_back(p.getPatrimonio());
+    columnas.deudas.push_back(p.getDeudas());
+    columnas.declaranteRenta.push_back(p.getDeclaranteRenta() ? 1 : 0);
+    columnas.grupoDeclaracion.push_back(p.getGrupoDeclaracion());
+  }
+  columnas.indexarIDs();
+  return columnas;
+}
+
+/**
+ * Implementación de construirPersonas.
+ *
+ * POR QUÉ: Las opciones por filas necesitan vector<Persona> aunque los datos vengan de columnas.
+ * CÓMO: Un recorrido que arma cada Persona con el constructor de códigos.
+ * PARA QUÉ: Reconstruir la colección sin volver a generarla ni buscar en los diccionarios.
+ */
+ColeccionPersonas construirPersonas(const PersonaColumns& columnas) {
+  ColeccionPersonas personas;
+  personas.reserve(columnas.size());
+
+  for (size_t i = 0; i < columnas.size(); ++i) {
+    personas.emplace_back(columnas.nombre[i], columnas.apellido[i], columnas.id[i],
+                          static_cast<CodigoCadena>(columnas.ciudad[i]), columnas.fechaNacimiento[i],
+                          columnas.ingresosAnuales[i], columnas.patrimonio[i], columnas.deudas[i],
+                          columnas.declaranteRenta[i] != 0, columnas.grupoDeclaracion[i]);
+  }
+  return personas;
+}
+
+/**
+ * Implementación de construirIndiceID.
+ *
+ * POR QUÉ: buscarPorID necesita la fila de cada ID sin recorrer la colección.
+ * CÓMO: Un recorrido que detecta si los IDs son consecutivos (ver IndiceID).
+ * PARA QUÉ: Construir el índice una vez por conjunto de datos.
+ */
+IndiceID construirIndiceID(const ColeccionPersonas* personas) {
+  IndiceID indice;
+  indice.construir(personas->size(), [personas](size_t i) { return (*personas)[i].getId(); });
+  return indice;
+}
+
 /**
  * Implementación de buscarPorID.
  *
  * POR QUÉ: Encontrar una persona por su ID en una colección.
- * CÓMO: Usando un algoritmo de búsqueda secuencial (lineal).
+ * CÓMO: El índice da la fila en O(1) (o por hash si los IDs no son consecutivos);
+ *       se confirma que esa fila tenga el ID por si el índice quedó desactualizado.
  * PARA QUÉ: Para operaciones de búsqueda en la aplicación.
  */
- const Persona* buscarPorID(const std::vector<Persona>& personas, const std::string& id) {
-  // Usamos lower_bound para encontrar la posición del primer elemento no menor que 'id'
-  auto it = std::lower_bound(personas.begin(), personas.end(), id,
-      [](const Persona& p, const std::string& id) {
-          return p.getId() < id;  // Compara por el ID de la persona
-      });
-
-  // Verificamos si encontramos el elemento exacto
-  if (it != personas.end() && it->getId() == id) {
-      return &(*it);  // Retorna un puntero a la persona encontrada
-  } else {
-      return nullptr;  // Si no se encuentra, devuelve nullptr
+const Persona* buscarPorID(const ColeccionPersonas& personas, const IndiceID& indice, uint64_t id) {
+  size_t fila = indice.buscar(id);
+  if (fila < personas.size() && personas[fila].getId() == id) {
+      return &personas[fila];  // Retorna un puntero a la persona encontrada
   }
+  return nullptr;  // Si no se encuentra, devuelve nullptr
 }
 
 
@@ -175,7 +373,7 @@ std::vector<Persona> generarColeccion(int n) {
  * PARA QUÉ: Obtener información de la persona con mayor patrimonio en el país
  *           para su posterior visualización o procesamiento.
  */
-const Persona* buscarMayorPatrimonio(const std::vector<Persona>* personas) {
+const Persona* buscarMayorPatrimonio(const ColeccionPersonas* personas) {
     // Si no hay personas en la colección, no hay máximo que buscar
     if (personas->empty()) return nullptr;
 
@@ -194,24 +392,20 @@ const Persona* buscarMayorPatrimonio(const std::vector<Persona>* personas) {
  * Imprime un listado de las personas con mayor patrimonio en cada ciudad.
  * 
  * POR QUÉ: Encontrar a la persona con mayor patrimonio en cada ciudad de Colombia.
- * CÓMO: Usando un mapa temporal para ir guardando, por ciudad, la persona con
- *       mayor patrimonio encontrada hasta el momento.
+ * CÓMO: El código de ciudad indexa un arreglo con la persona de
+ *       mayor patrimonio encontrada hasta el momento (sin hash de strings).
  * PARA QUÉ: Listar y mostrar personas con mayor patrimonio por ciudad.
  */
 
 // Busca e imprime la persona con mayor patrimonio por cada ciudad
-void buscarMayoresPatrimonioPorCiudad(const std::vector<Persona>* personas) {
-  // Mapa que guarda, para cada ciudad, un puntero a la Persona con mayor patrimonio
-  std::unordered_map<std::string, const Persona*> mayoresPorCiudad;
-  mayoresPorCiudad.reserve(64); // Reserva aproximada para evitar rehashes innecesarios
+void buscarMayoresPatrimonioPorCiudad(const ColeccionPersonas* personas) {
+  // Arreglo indexado por código de ciudad con un puntero a la Persona de mayor patrimonio
+  std::vector<const Persona*> mayoresPorCiudad(diccionarioCiudades().size(), nullptr);
 
   // Recorremos todas las personas y seleccionamos la de mayor patrimonio por ciudad
   for (const auto& p : *personas) {
-      const std::string& ciudad = p.getCiudadNacimiento(); // obtenemos la ciudad
-
-      // Referencia al puntero asociado a esa ciudad en el mapa.
-      // Si la ciudad no existe aún, se crea con valor nullptr.
-      const Persona*& best = mayoresPorCiudad[ciudad];
+      // Referencia al puntero asociado a esa ciudad (nullptr si aún no hay persona)
+      const Persona*& best = mayoresPorCiudad[p.getCodigoCiudad()];
 
       // Si no había persona registrada o esta tiene más patrimonio, actualizamos
       if (best == nullptr || p.getPatrimonio() > best->getPatrimonio()) {
@@ -225,14 +419,13 @@ void buscarMayoresPatrimonioPorCiudad(const std::vector<Persona>* personas) {
   // Configuramos el formato: fijo, con decimales (2) → se imprime como decimal
   std::cout << std::fixed << std::setprecision(2);
 
-  // Recorremos el mapa e imprimimos los resultados
-  for (const auto& kv : mayoresPorCiudad) {
-      const std::string& ciudad = kv.first;   // clave del mapa = ciudad
-      const Persona* persona = kv.second;     // valor = puntero a Persona
-      if (!persona) continue;                 // seguridad por si hubiera nulos
+  // Recorremos las ciudades en orden de código e imprimimos los resultados
+  for (size_t c = 0; c < mayoresPorCiudad.size(); ++c) {
+      const Persona* persona = mayoresPorCiudad[c];
+      if (!persona) continue;                 // ciudad sin personas
 
       // Mostramos ciudad y datos de la persona con mayor patrimonio
-      std::cout << "- " << ciudad << ": "
+      std::cout << "- " << diccionarioCiudades().texto(c) << ": "
                 << persona->getNombre() << " "
                 << persona->getApellido() << " ("
                 << persona->getPatrimonio() << ")\n";
@@ -248,10 +441,10 @@ void buscarMayoresPatrimonioPorCiudad(const std::vector<Persona>* personas) {
  * PARA QUÉ: Listar y mostrar personas con mayor patrimonio por grupo.
  */
  // Busca e imprime la persona con mayor patrimonio por cada grupo
-void buscarMayoresPatrimonioPorGrupo(const std::vector<Persona>* personas) {
+void buscarMayoresPatrimonioPorGrupo(const ColeccionPersonas* personas) {
   // Mapa que guarda, para cada grupo (char), un puntero a la Persona con mayor patrimonio encontrada
   std::unordered_map<char, const Persona*> mayoresPorGrupo;
-  mayoresPorGrupo.reserve(personas->size()); // Reservamos espacio (si son pocos grupos, esto se puede ajustar)
+  mayoresPorGrupo.reserve(4); // Solo hay 4 grupos (A, B, C y N)
 
   // Recorremos todas las personas para determinar la de mayor patrimonio por grupo
   for (const auto& p : *personas) {
@@ -292,18 +485,18 @@ void buscarMayoresPatrimonioPorGrupo(const std::vector<Persona>* personas) {
  * Implementación de buscarPersonaMasLongevaConCondicion--
  * 
  * POR QUÉ: Encontrar la persona más longeva (con la fecha de nacimiento más antigua) en una colección de personas.
- * CÓMO: Recorriendo el vector de personas y comparando fechas de nacimiento; si se encuentra la fecha más antigua posible, termina la búsqueda anticipadamente.
+ * CÓMO: Recorriendo el vector de personas y comparando fechas de nacimiento como enteros AAAAMMDD (orden cronológico); si se encuentra la fecha más antigua posible, termina la búsqueda anticipadamente.
  * PARA QUÉ: Para obtener rápidamente la persona más longeva en el país, optimizando el tiempo si aparece la fecha mínima.
  */
-const Persona* buscarPersonaMasLongevaConCondicion(const std::vector<Persona>* personas) { //toma el vector de Persona como input
+const Persona* buscarPersonaMasLongevaConCondicion(const ColeccionPersonas* personas) { //toma el vector de Persona como input
     if (personas->empty()) return nullptr;
 
-    const std::string fechaObjetivo = "1/1/1960";  //fecha mas antigua posible
+    const FechaAAAAMMDD fechaObjetivo = FECHA_MAS_ANTIGUA;  // fecha más antigua posible
     const Persona* masLongeva = &(*personas)[0];  //inicialización de puntero con primera Persona
-    std::string fechaMasLongeva = masLongeva->getFechaNacimiento();   
+    FechaAAAAMMDD fechaMasLongeva = masLongeva->getFechaNacimiento();   
 
     for (size_t i = 1; i < personas->size(); ++i) {  //recorrido del vector desde la seguna Persona
-        const std::string fechaActual = (*personas)[i].getFechaNacimiento();
+        const FechaAAAAMMDD fechaActual = (*personas)[i].getFechaNacimiento();
         if (fechaActual < fechaMasLongeva) {   
             masLongeva = &(*personas)[i];  //actualiza puntero despues de comparación
             fechaMasLongeva = masLongeva->getFechaNacimiento();
@@ -320,33 +513,29 @@ const Persona* buscarPersonaMasLongevaConCondicion(const std::vector<Persona>* p
  * Implementación de mostrarPersonasMasLongevaPorCiudad_Vector.
  * 
  * POR QUÉ: Mostrar la persona más longeva de cada ciudad en una colección de personas.
- * CÓMO: Recorriendo el vector de personas, agrupando por ciudad y comparando fechas de nacimiento para cada grupo.
+ * CÓMO: Recorriendo el vector de personas; el código de ciudad indexa la persona más longeva de cada ciudad.
  * PARA QUÉ: Para visualizar, por ciudad, quién es la persona más longeva, útil para estadísticas y reportes por región.
  */
-void mostrarPersonasMasLongevaPorCiudad_Vector(const std::vector<Persona>* personas) { //recibe referencia
-    std::vector<std::pair<std::string, const Persona*>> resultado; //lista dinamica de pares (ciudad, persona*) 
+void mostrarPersonasMasLongevaPorCiudad_Vector(const ColeccionPersonas* personas) { //recibe referencia
+    // Persona más longeva de cada ciudad, indexada por código de ciudad
+    std::vector<const Persona*> resultado(diccionarioCiudades().size(), nullptr);
 
     for (const auto& persona : *personas) {  
-        std::string ciudad = persona.getCiudadNacimiento();
-        auto iter = std::find_if(resultado.begin(), resultado.end(), //observa si ya hay un par con esa ciudad
-            [&ciudad](const std::pair<std::string, const Persona*>& par) {  //compara el  par guardado con ciudad (de la iteración)
-                return par.first == ciudad;
-            });
-        if (iter == resultado.end()) { //si no está la ciudad, se agrega
-            resultado.push_back({ciudad, &persona});
-        } else {  //si ya está,compara fechas con la persona(second) y actualiza si es necesario
-            if (persona.getFechaNacimiento() < iter->second->getFechaNacimiento()) {
-                iter->second = &persona;
-            }
+        const Persona*& masLongeva = resultado[persona.getCodigoCiudad()];
+        if (masLongeva == nullptr) { //si la ciudad no tenía persona, se asigna
+            masLongeva = &persona;
+        } else if (persona.getFechaNacimiento() < masLongeva->getFechaNacimiento()) {
+            masLongeva = &persona; //si ya tenía, compara fechas y actualiza si es necesario
         }
     }
 
     std::cout << "\n=== Persona más longeva por ciudad ===\n";
-    for (const auto& par : resultado) {
-        std::cout << "- " << par.first << ": "
-                  << par.second->getNombre() << " "
-                  << par.second->getApellido() << " ("
-                  << par.second->getFechaNacimiento() << ")\n";
+    for (size_t c = 0; c < resultado.size(); ++c) {
+        if (!resultado[c]) continue;
+        std::cout << "- " << diccionarioCiudades().texto(c) << ": "
+                  << resultado[c]->getNombre() << " "
+                  << resultado[c]->getApellido() << " ("
+                  << formatearFecha(resultado[c]->getFechaNacimiento()) << ")\n";
     }
 }
 
@@ -358,7 +547,7 @@ void mostrarPersonasMasLongevaPorCiudad_Vector(const std::vector<Persona>* perso
  * PARA QUÉ: Listar y mostrar personas que si pertencen.
  */
  // Busca e imprime la persona con mayor patrimonio por cada grupo. 
-void listarPersonasGrupo(const std::vector<Persona>* personas,char grupoDeclaracion,int* contador) {
+void listarPersonasGrupo(const ColeccionPersonas* personas,char grupoDeclaracion,int* contador) {
     if (!personas) { std::cerr << "[listar] personas == nullptr\n"; return; }
     if (!contador) { std::cerr << "[listar] contador == nullptr\n"; return; }
 
@@ -366,124 +555,54 @@ void listarPersonasGrupo(const std::vector<Persona>* personas,char grupoDeclarac
     grupoDeclaracion = std::toupper(static_cast<unsigned char>(grupoDeclaracion));
 
     std::cout << "Personas del grupo " << grupoDeclaracion << " encontradas:\n";
-    for (const Persona& p : *personas) {
-        if (p.getGrupoDeclaracion() == grupoDeclaracion) {
-            std::cout << p.getId() << " " << p.getNombre() << " " << p.getPatrimonio() << "\n";
-            ++(*contador);
-        }
-    }
+    // Las líneas se formatean en búferes y se escriben por bloques (ver salida.h)
+    *contador += static_cast<int>(escribirRegistros(personas->size(), hilosSalida(), [&](size_t i, BufferTexto& salida) {
+        const Persona& p = (*personas)[i];
+        if (p.getGrupoDeclaracion() != grupoDeclaracion) return false;
+        salida.agregarEntero(p.getId());
+        salida.agregar(' ');
+        salida.agregar(p.getNombre());
+        salida.agregar(' ');
+        salida.agregarDecimal2(p.getPatrimonio());
+        salida.agregar('\n');
+        return true;
+    }));
 }
 
 /**
  * Implementación de calcularGrupoMayorPorCiudad.
  * 
  * POR QUÉ: Calcular el grupo con más personas en cada ciudad.
- * CÓMO: Recorriendo el vector de personas, agrupando por grupo y las cantidades de cada grupo por ciudad.
+ * CÓMO: Recorriendo el vector de personas y contando cada grupo en la fila de su código de ciudad.
  * PARA QUÉ: Para visualizar, por ciudad, cuál es el grupo con más personas, útil para estadísticas y reportes por región.
  */
 // Función para calcular el grupo más grande por ciudad
-void calcularGrupoMayorPorCiudad(const std::vector<Persona> *personas) {
-  // Inicialización de las variables
-  int ciudadesGrupos[20][3] = {{0}}; // 20 ciudades, 3 grupos
-  std::unordered_map<std::string, int> ciudadIndex = {
-      {"Bogotá", 0},       {"Medellín", 1},       {"Cali", 2},
-      {"Barranquilla", 3}, {"Cartagena", 4},      {"Bucaramanga", 5},
-      {"Pereira", 6},      {"Santa Marta", 7},    {"Cúcuta", 8},
-      {"Ibagué", 9},       {"Manizales", 10},     {"Pasto", 11},
-      {"Neiva", 12},       {"Villavicencio", 13}, {"Armenia", 14},
-      {"Sincelejo", 15},   {"Valledupar", 16},    {"Montería", 17},
-      {"Popayán", 18},     {"Tunja", 19}};
+void calcularGrupoMayorPorCiudad(const ColeccionPersonas *personas) {
+  // Conteo por (ciudad, grupo): el código de ciudad es directamente la fila
+  const size_t numCiudades = diccionarioCiudades().size();
+  std::vector<int> ciudadesGrupos(numCiudades * 3, 0); // 3 grupos por ciudad
 
   // Recorremos las personas y sumamos los grupos
   for (const Persona &persona : *personas) {
-    std::string ciudad = persona.getCiudadNacimiento();
     char grupo = persona.getGrupoDeclaracion();
-
-    int index1 = ciudadIndex[ciudad];
     if (grupo != 'N') {
       int index2 = (grupo == 'A' ? 0 : (grupo == 'B' ? 1 : 2));
-      ciudadesGrupos[index1][index2]++;
+      ciudadesGrupos[persona.getCodigoCiudad() * 3 + index2]++;
     }
   }
 
   // Mostrar el grupo mayor por ciudad
-  for (int i = 0; i < 20; i++) {
-    std::string ciudad;
-    switch (i) {
-    case 0:
-      ciudad = "Bogotá";
-      break;
-    case 1:
-      ciudad = "Medellín";
-      break;
-    case 2:
-      ciudad = "Cali";
-      break;
-    case 3:
-      ciudad = "Barranquilla";
-      break;
-    case 4:
-      ciudad = "Cartagena";
-      break;
-    case 5:
-      ciudad = "Bucaramanga";
-      break;
-    case 6:
-      ciudad = "Pereira";
-      break;
-    case 7:
-      ciudad = "Santa Marta";
-      break;
-    case 8:
-      ciudad = "Cúcuta";
-      break;
-    case 9:
-      ciudad = "Ibagué";
-      break;
-    case 10:
-      ciudad = "Manizales";
-      break;
-    case 11:
-      ciudad = "Pasto";
-      break;
-    case 12:
-      ciudad = "Neiva";
-      break;
-    case 13:
-      ciudad = "Villavicencio";
-      break;
-    case 14:
-      ciudad = "Armenia";
-      break;
-    case 15:
-      ciudad = "Sincelejo";
-      break;
-    case 16:
-      ciudad = "Valledupar";
-      break;
-    case 17:
-      ciudad = "Montería";
-      break;
-    case 18:
-      ciudad = "Popayán";
-      break;
-    case 19:
-      ciudad = "Tunja";
-      break;
-    default:
-      ciudad = "Ciudad no encontrada";
-      break;
-    }
+  for (size_t i = 0; i < numCiudades; i++) {
+    const int *grupos = &ciudadesGrupos[i * 3];
 
     // Encontramos el grupo con más personas
-    int mayorGrupo = std::max(
-        {ciudadesGrupos[i][0], ciudadesGrupos[i][1], ciudadesGrupos[i][2]});
-    char mayorGrupoLetra = (mayorGrupo == ciudadesGrupos[i][0])   ? 'A'
-                           : (mayorGrupo == ciudadesGrupos[i][1]) ? 'B'
-                                                                  : 'C';
+    int mayorGrupo = std::max({grupos[0], grupos[1], grupos[2]});
+    char mayorGrupoLetra = (mayorGrupo == grupos[0])   ? 'A'
+                           : (mayorGrupo == grupos[1]) ? 'B'
+                                                       : 'C';
 
     // Mostramos el resultado
-    std::cout << "El grupo con más personas en la ciudad " << ciudad
+    std::cout << "El grupo con más personas en la ciudad " << diccionarioCiudades().texto(i)
               << " es el grupo " << mayorGrupoLetra << " con " << mayorGrupo
               << " personas." << std::endl;
   }
@@ -497,36 +616,27 @@ void calcularGrupoMayorPorCiudad(const std::vector<Persona> *personas) {
  * PARA QUÉ: Para visualizar, en el país, las 3 ciudades con el promedio de patrimonio más alto, útil para estadísticas y reportes de la región.
  */
 // Función que calcula el promedio de patrimonio por ciudad
-void calcularPromedioPatrimonio(const std::vector<Persona> *personas) {
-  double ciudadesPromedios[20] = {0};
-  int conteoCiudad[20] = {0};
+void calcularPromedioPatrimonio(const ColeccionPersonas *personas) {
+  // Sumas y conteos indexados por código de ciudad
+  const size_t numCiudades = diccionarioCiudades().size();
+  std::vector<double> ciudadesPromedios(numCiudades, 0.0);
+  std::vector<int> conteoCiudad(numCiudades, 0);
 
   // Recorremos a cada persona y sumamos el patrimonio por ciudad
   for (const Persona &persona : *personas) {
-    std::string ciudad = persona.getCiudadNacimiento();
-    double patrimonio = persona.getPatrimonio();
-
-    // Buscar el índice de la ciudad
-    int index1;
-    for (int i = 0; i < 20; i++) {
-      if (ciudadesColombiaRef[i] == ciudad) {
-        index1 = i;
-        break;
-      }
-    }
-    // Incrementamos la cuenta de personas y sumamos el patrimonio
-    ciudadesPromedios[index1] += patrimonio;
-    conteoCiudad[index1]++;
+    CodigoCadena ciudad = persona.getCodigoCiudad();
+    ciudadesPromedios[ciudad] += persona.getPatrimonio();
+    conteoCiudad[ciudad]++;
   }
   // Creamos un arreglo de pares (promedio, idCiudad) para ordenar
   std::vector<std::pair<float, int>> promediosConId;
 
   // Calculamos los promedios y agregarlos con su ID
-  for (int i = 0; i < 20; i++) {
+  for (size_t i = 0; i < numCiudades; i++) {
     if (conteoCiudad[i] > 0) { // Si hay al menos una persona en esa ciudad
       float promedio = ciudadesPromedios[i] / conteoCiudad[i];
       promediosConId.push_back(
-          {promedio, i}); // Guardar el promedio junto con el ID de la ciudad
+          {promedio, static_cast<int>(i)}); // Guardar el promedio junto con el ID de la ciudad
     }
   }
 
@@ -545,9 +655,9 @@ void calcularPromedioPatrimonio(const std::vector<Persona> *personas) {
                    2); // Fija a dos decimales y evita notación científica
   std::cout << std::showpoint; // Asegura que se muestren los ceros decimales
 
-  for (int i = 0; i < 3 && i < promediosConId.size(); ++i) {
+  for (size_t i = 0; i < 3 && i < promediosConId.size(); ++i) {
     int idCiudad = promediosConId[i].second; // Obtenemos el ID de la ciudad
-    std::cout << ciudadesColombia[idCiudad] << ": " << promediosConId[i].first
+    std::cout << diccionarioCiudades().texto(idCiudad) << ": " << promediosConId[i].first
               << std::endl;
   }
 }
@@ -561,7 +671,7 @@ void calcularPromedioPatrimonio(const std::vector<Persona> *personas) {
  * PARA QUÉ: Obtener información de la persona con mayor deuda
  *           para su posterior visualización o procesamiento.
  */
-const Persona* buscarMayorDeuda(const std::vector<Persona>* personas) {
+const Persona* buscarMayorDeuda(const ColeccionPersonas* personas) {
     // Si no hay personas en la colección, no hay máximo que buscar
     if (personas->empty()) return nullptr;
 
@@ -580,23 +690,21 @@ const Persona* buscarMayorDeuda(const std::vector<Persona>* personas) {
  * Imprime un listado de las personas con mayor deuda en cada ciudad.
  * 
  * POR QUÉ: Encontrar a la persona con mayor deuda en cada ciudad de la colección.
- * CÓMO: Usando un mapa temporal para ir guardando, por ciudad, la persona con
- *       mayor deuda encontrada hasta el momento.
+ * CÓMO: El código de ciudad indexa un arreglo con la persona de
+ *       mayor deuda encontrada hasta el momento (sin hash de strings).
  * PARA QUÉ: Listar y mostrar personas con mayor deuda por ciudad.
  */
- void buscarMayoresDeudasPorCiudad(const std::vector<Persona>* personas) {
-  // Mapa que guarda, para cada ciudad, un puntero a la Persona con mayor deuda encontrada
-  std::unordered_map<std::string, const Persona*> mayoresPorCiudad;
-  mayoresPorCiudad.reserve(personas->size()); // Reservamos (se puede ajustar según nº de ciudades)
+ void buscarMayoresDeudasPorCiudad(const ColeccionPersonas* personas) {
+  // Arreglo indexado por código de ciudad con un puntero a la Persona de mayor deuda
+  std::vector<const Persona*> mayoresPorCiudad(diccionarioCiudades().size(), nullptr);
 
   // Recorremos todas las personas y actualizamos si encontramos mayor deuda en la ciudad
   for (const auto& p : *personas) {
-      const std::string& ciudad = p.getCiudadNacimiento(); // ciudad asociada a la persona
-      auto it = mayoresPorCiudad.find(ciudad);
+      const Persona*& best = mayoresPorCiudad[p.getCodigoCiudad()];
 
-      // Si la ciudad no estaba o la persona actual tiene más deuda, actualizamos
-      if (it == mayoresPorCiudad.end() || p.getDeudas() > it->second->getDeudas()) {
-          mayoresPorCiudad[ciudad] = &p;
+      // Si la ciudad no tenía persona o la actual tiene más deuda, actualizamos
+      if (best == nullptr || p.getDeudas() > best->getDeudas()) {
+          best = &p;
       }
   }
 
@@ -608,14 +716,13 @@ const Persona* buscarMayorDeuda(const std::vector<Persona>* personas) {
   // - std::setprecision(2): con dos decimales → valor decimal
   std::cout << std::fixed << std::setprecision(2);
 
-  // Recorremos el mapa e imprimimos los resultados
-  for (const auto& kv : mayoresPorCiudad) { // kv: {ciudad, persona}
-      const std::string& ciudad = kv.first; // clave = ciudad
-      const Persona* persona = kv.second;   // valor = persona con mayor deuda
-      if (!persona) continue;               // seguridad ante punteros nulos
+  // Recorremos las ciudades en orden de código e imprimimos los resultados
+  for (size_t c = 0; c < mayoresPorCiudad.size(); ++c) {
+      const Persona* persona = mayoresPorCiudad[c];
+      if (!persona) continue;               // ciudad sin personas
 
       // Mostramos ciudad y datos de la persona con mayor deuda
-      std::cout << "- " << ciudad << ": "
+      std::cout << "- " << diccionarioCiudades().texto(c) << ": "
                 << persona->getNombre() << " "
                 << persona->getApellido() << " ("
                 << persona->getDeudas() << ")\n";
@@ -633,10 +740,10 @@ const Persona* buscarMayorDeuda(const std::vector<Persona>* personas) {
  * PARA QUÉ: Listar y mostrar personas con mayor deuda por grupo.
  */
 // Busca e imprime la persona con mayor deuda por cada grupo
-void buscarMayoresDeudasPorGrupo(const std::vector<Persona>* personas) {
+void buscarMayoresDeudasPorGrupo(const ColeccionPersonas* personas) {
   // Mapa que guarda, para cada grupo (char), un puntero a la Persona con mayor deuda encontrada
   std::unordered_map<char, const Persona*> mayoresPorGrupo;
-  mayoresPorGrupo.reserve(personas->size()); // Reservamos (puede ser mucho para pocos grupos, ajustar si hace falta)
+  mayoresPorGrupo.reserve(4); // Solo hay 4 grupos (A, B, C y N)
 
   // Recorremos todas las personas y mantenemos la de mayor deuda por grupo
   for (const auto& p : *personas) {
@@ -2,6 +2,11 @@
 #define GENERADOR_H
 
 #include "persona.h"
+#include "agregados.h"
+#include "aleatorio.h"
+#include "columnas.h"
+#include "indice_id.h"
+#include <cstdint>
 #include <vector>
 
 // Funciones para generación de datos aleatorios
@@ -10,10 +15,19 @@
  * Genera una fecha de nacimiento aleatoria entre 1960 y 2010.
  * 
  * POR QUÉ: Simular fechas realistas para personas.
- * CÓMO: Combinando números aleatorios para día, mes y año.
+ * CÓMO: Combinando números aleatorios para día, mes y año en un entero AAAAMMDD.
  * PARA QUÉ: Inicializar el atributo fechaNacimiento de Persona.
  */
-std::string generarFechaNacimiento();
+FechaAAAAMMDD generarFechaNacimiento();
+
+/**
+ * Genera una fecha de nacimiento a partir de un generador basado en contador.
+ * 
+ * POR QUÉ: La versión con rand() no se puede llamar desde varios hilos.
+ * CÓMO: Mismo rango que generarFechaNacimiento(), tomando los valores de 'gen'.
+ * PARA QUÉ: Generación paralela y reproducible.
+ */
+FechaAAAAMMDD generarFechaNacimiento(GeneradorContador& gen);
 
 /**
  * Genera un ID único secuencial.
@@ -22,7 +36,7 @@ std::string generarFechaNacimiento();
  * CÓMO: Usando un contador estático que incrementa en cada llamada.
  * PARA QUÉ: Garantizar unicidad en los IDs.
  */
-int generarID();
+uint64_t generarID();
 
 /**
  * Genera un número decimal aleatorio en un rango [min, max].
@@ -42,6 +56,16 @@ double randomDouble(double min, double max);
  */
 Persona generarPersona();
 
+/**
+ * Crea la persona número 'indice' de forma determinista.
+ * 
+ * POR QUÉ: generarPersona() depende de estado global (rand(), mt19937 estático)
+ *          y no es seguro llamarla desde varios hilos.
+ * CÓMO: Usa un GeneradorContador con clave (semilla, indice); el ID es 1000000000 + indice.
+ * PARA QUÉ: Que cada hilo genere su parte del conjunto sin compartir estado.
+ */
+Persona generarPersona(uint64_t semilla, uint64_t indice);
+
 /**
  * Genera una colección (vector) de n personas.
  * 
@@ -49,71 +73,119 @@ Persona generarPersona();
  * CÓMO: Llamando a generarPersona() n veces.
  * PARA QUÉ: Pruebas de rendimiento y funcionalidad con volúmenes variables.
  */
-std::vector<Persona> generarColeccion(int n);
+ColeccionPersonas generarColeccion(int n);
+
+/**
+ * Genera una colección de n personas repartiendo el trabajo entre varios hilos.
+ * 
+ * POR QUÉ: La generación secuencial usa un solo núcleo y tarda segundos con 10M registros.
+ * CÓMO: Divide [0, n) en bloques contiguos; cada hilo llena su bloque con
+ *       generarPersona(semilla, i).
+ * PARA QUÉ: Crear conjuntos grandes rápidamente y con el mismo contenido
+ *           sin importar el número de hilos.
+ * 
+ * @param n Número de personas.
+ * @param semilla Semilla del conjunto (misma semilla => mismos datos).
+ * @param hilos Número de hilos; 0 usa todos los núcleos disponibles.
+ */
+ColeccionPersonas generarColeccionParalela(int n, uint64_t semilla, unsigned hilos);
+
+// Genera n personas como generarColeccionParalela pero pasa cada una a un AgregadoEnFlujo
+// y la descarta: memoria O(ciudades x grupos) para cualquier n (ver agregados.h)
+AgregadoEnFlujo generarYAgregar(uint64_t n, uint64_t semilla, unsigned hilos);
+
+/**
+ * Convierte la colección de personas al almacén columnar PersonaColumns.
+ * 
+ * POR QUÉ: Cada Persona arrastra cinco strings aunque la consulta lea un solo double.
+ * CÓMO: Copia cada atributo a su columna; el ID se convierte a entero.
+ * PARA QUÉ: Ejecutar las consultas columnares declaradas en columnas.h.
+ */
+PersonaColumns construirColumnas(const ColeccionPersonas* personas);
+
+/**
+ * Reconstruye la colección de personas a partir del almacén columnar.
+ *
+ * POR QUÉ: Una instantánea cargada solo trae columnas, pero las opciones 1 a 10
+ *          trabajan sobre vector<Persona>.
+ * CÓMO: Crea cada Persona con los códigos de diccionario y la fecha de su fila.
+ * PARA QUÉ: Usar las consultas por filas sin regenerar los datos.
+ */
+ColeccionPersonas construirPersonas(const PersonaColumns& columnas);
+
+/**
+ * Construye el índice ID -> fila de la colección.
+ * 
+ * POR QUÉ: Buscar por ID recorriendo o bisecando el vector cuesta O(n) u O(log n) por consulta.
+ * CÓMO: Ver IndiceID: acceso directo si los IDs son consecutivos, tabla hash si no.
+ * PARA QUÉ: Que buscarPorID responda en O(1).
+ */
+IndiceID construirIndiceID(const ColeccionPersonas* personas);
 
 /**
  * Busca una persona por ID en un vector de personas.
  * 
  * POR QUÉ: Recuperar una persona específica de una colección.
- * CÓMO: Usando un algoritmo de búsqueda lineal (o binaria si se ordena).
+ * CÓMO: Consulta la fila en el índice y confirma que tenga el ID buscado.
  * PARA QUÉ: Implementar funcionalidad de búsqueda en la aplicación.
  * 
  * @param personas Vector de personas donde buscar.
+ * @param indice Índice construido con construirIndiceID() sobre la misma colección.
  * @param id ID a buscar.
  * @return Puntero a la persona encontrada o nullptr si no se encuentra.
  */
- const Persona* buscarPorID(const std::vector<Persona>& personas, const std::string& id);
+const Persona* buscarPorID(const ColeccionPersonas& personas, const IndiceID& indice, uint64_t id);
 
 /**
  * Busca la persona con mayor patrimonio en todo el país.
  */
-const Persona* buscarMayorPatrimonio(const std::vector<Persona>* personas);
+const Persona* buscarMayorPatrimonio(const ColeccionPersonas* personas);
 
 /**
  * Obtiene un listado con la persona de mayor patrimonio en cada ciudad.
  */
-void buscarMayoresPatrimonioPorCiudad(const std::vector<Persona>* personas);
+void buscarMayoresPatrimonioPorCiudad(const ColeccionPersonas* personas);
 
 
 /**
  * Obtiene un listado con la persona de mayor patrimonio por grupo de declaración.
  */
-void buscarMayoresPatrimonioPorGrupo(const std::vector<Persona>* personas);
+void buscarMayoresPatrimonioPorGrupo(const ColeccionPersonas* personas);
 
-void listarPersonasGrupo(const std::vector<Persona>* personas, char grupoDeclaracion, int* contador);
+void listarPersonasGrupo(const ColeccionPersonas* personas, char grupoDeclaracion, int* contador);
 
 /**
  * Obtiene un listado con la persona más longeva de todo el país.
  */
-const Persona* buscarPersonaMasLongevaConCondicion(const std::vector<Persona>* personas);   //toma del vector personas las referencias a su direccion de memoria
+const Persona* buscarPersonaMasLongevaConCondicion(const ColeccionPersonas* personas);   //toma del vector personas las referencias a su direccion de memoria
 
 /**
  * Obtiene la persona mas longeva de cada ciudad
  */
-void mostrarPersonasMasLongevaPorCiudad_Vector(const std::vector<Persona>* personas);
+void mostrarPersonasMasLongevaPorCiudad_Vector(const ColeccionPersonas* personas);
 
 
 //Definición de la función que calcula el grupo con más personas de cada ciudad
-void calcularGrupoMayorPorCiudad(const std::vector<Persona> *personas);
+void calcularGrupoMayorPorCiudad(const ColeccionPersonas *personas);
 
 //Definición de la función que calcula los promedios de patrimonio por ciudad, y muestra los primeros 3
-void calcularPromedioPatrimonio(const std::vector<Persona> *personas);
+void calcularPromedioPatrimonio(const ColeccionPersonas *personas);
 
 /**
  * Busca la persona con mayor deudas en todo el país.
  */
-const Persona* buscarMayorDeuda(const std::vector<Persona>* personas);
+const Persona* buscarMayorDeuda(const ColeccionPersonas* personas);
 
 /**
  * Obtiene un listado con la persona de mayor deuda en cada ciudad.
  */
-void buscarMayoresDeudasPorCiudad(const std::vector<Persona>* personas);
+void buscarMayoresDeudasPorCiudad(const ColeccionPersonas* personas);
 
 
 /**
  * Obtiene un listado con la persona de mayor deuda por grupo de declaración.
  */
-void buscarMayoresDeudasPorGrupo(const std::vector<Persona>* personas);
+void buscarMayoresDeudasPorGrupo(const ColeccionPersonas* personas);
 
 #endif // GENERADOR_H
 
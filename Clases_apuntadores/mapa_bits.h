@@ -0,0 +1,140 @@
+#ifndef MAPA_BITS_H
+#define MAPA_BITS_H
+
+#include "paralelo.h"
+#include "vectorial.h" // contarBits
+#include <algorithm> // std::fill, std::min
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * Mapa de bits de filas: el bit i vale 1 si la fila i cumple una condición.
+ *
+ * Palabras de 64 bits sin comprimir: los grupos y las ciudades son densos (cada valor
+ * cubre del 5% al 40% de las filas), así que una compresión tipo roaring guardaría casi
+ * todos sus contenedores como mapas de bits igualmente. Los bits después de la última
+ * fila valen 0, de modo que contar e intersecar pueden leer palabras completas.
+ */
+class MapaBits {
+public:
+    MapaBits() : filas_(0) {}
+    explicit MapaBits(size_t filas) : palabras_((filas + 63) / 64, 0), filas_(filas) {}
+
+    size_t filas() const { return filas_; }
+    size_t numPalabras() const { return palabras_.size(); }
+    const uint64_t* palabras() const { return palabras_.data(); }
+    uint64_t* palabras() { return palabras_.data(); }
+
+    bool contiene(size_t fila) const { return (palabras_[fila / 64] >> (fila % 64)) & 1; }
+
+    // Filas con el bit en 1 (popcount vectorial, ver vectorial.h)
+    size_t contar() const { return contarBits(palabras_.data(), palabras_.size()); }
+
+    /**
+     * Filas con el bit en 1 en todos los mapas 'incluidos' y en 0 en todos los 'excluidos'.
+     *
+     * CÓMO: Por tramos de TRAMO palabras (caben en L1): AND (y AND NOT) de cada mapa
+     *       sobre un búfer local, mapa por mapa para que cada bucle sea un recorrido
+     *       simple, y popcount vectorial del búfer. Sin 'incluidos' se parte de todas las filas.
+     */
+    static size_t contarInterseccion(size_t filas, const std::vector<const MapaBits*>& incluidos,
+                                     const std::vector<const MapaBits*>& excluidos) {
+        const size_t TRAMO = 512;
+        const size_t numPalabras = (filas + 63) / 64;
+        uint64_t bufer[TRAMO];
+        size_t total = 0;
+        for (size_t inicio = 0; inicio < numPalabras; inicio += TRAMO) {
+            const size_t n = std::min(TRAMO, numPalabras - inicio);
+            std::fill(bufer, bufer + n, ~uint64_t(0));
+            if (inicio + n == numPalabras && filas % 64 != 0) bufer[n - 1] = (uint64_t(1) << (filas % 64)) - 1;
+            for (const MapaBits* mapa : incluidos) {
+                const uint64_t* palabras = mapa->palabras_.data() + inicio;
+                for (size_t w = 0; w < n; ++w) bufer[w] &= palabras[w];
+            }
+            for (const MapaBits* mapa : excluidos) {
+                const uint64_t* palabras = mapa->palabras_.data() + inicio;
+                for (size_t w = 0; w < n; ++w) bufer[w] &= ~palabras[w];
+            }
+            total += contarBits(bufer, n);
+        }
+        return total;
+    }
+
+private:
+    std::vector<uint64_t> palabras_;
+    size_t filas_;
+};
+
+/**
+ * Mapas de bits de cada grupo de declaración, de cada ciudad y de los declarantes.
+ *
+ * POR QUÉ: Contar un grupo recorría las 10M filas (o las listaba, como la opción 7),
+ *          y combinar filtros como "grupo B en Cali y declarante" necesitaba otro recorrido.
+ * CÓMO: construir() reparte las palabras entre los hilos; cada hilo arma en registros
+ *       las 64 filas de una palabra para todos los mapas y las escribe una vez, así
+ *       ningún par de hilos escribe la misma palabra. Un conteo es un popcount por
+ *       palabra y un filtro combinado es el AND de los mapas antes del popcount.
+ * PARA QUÉ: Conteos por grupo, ciudad y declarante leyendo 1.25 MB por mapa con 10M
+ *           filas (156K palabras) y filtros combinados sin leer las columnas.
+ */
+class IndiceMapasBits {
+public:
+    IndiceMapasBits() : filasIndexadas_(0) {}
+
+    /**
+     * @param ciudadDeFila Función (size_t) -> código de ciudad en [0, numCiudades).
+     * @param grupoDeFila Función (size_t) -> índice de grupo en [0, numGrupos).
+     * @param esDeclarante Función (size_t) -> bool.
+     * @param hilos Hilos a usar (0 = todos los núcleos).
+     */
+    template <typename CiudadDeFila, typename GrupoDeFila, typename EsDeclarante>
+    void construir(size_t n, size_t numCiudades, size_t numGrupos, CiudadDeFila ciudadDeFila,
+                   GrupoDeFila grupoDeFila, EsDeclarante esDeclarante, unsigned hilos = 0) {
+        grupos_.assign(numGrupos, MapaBits(n));
+        ciudades_.assign(numCiudades, MapaBits(n));
+        declarantes_ = MapaBits(n);
+
+        const size_t numPalabras = (n + 63) / 64;
+        hilos = hilosEfectivos(hilos);
+        const size_t maximoHilos = std::max<size_t>(1, n / FILAS_MINIMAS_POR_HILO);
+        if (hilos > maximoHilos) hilos = static_cast<unsigned>(maximoHilos);
+        ejecutarEnBloques(numPalabras, hilos, [&](size_t inicio, size_t fin, unsigned) {
+            std::vector<uint64_t> palabrasGrupo(numGrupos), palabrasCiudad(numCiudades);
+            for (size_t w = inicio; w < fin; ++w) {
+                std::fill(palabrasGrupo.begin(), palabrasGrupo.end(), 0);
+                std::fill(palabrasCiudad.begin(), palabrasCiudad.end(), 0);
+                uint64_t palabraDeclarantes = 0;
+                const size_t finFilas = std::min(n, (w + 1) * 64);
+                for (size_t i = w * 64; i < finFilas; ++i) {
+                    const uint64_t bit = uint64_t(1) << (i % 64);
+                    palabrasGrupo[grupoDeFila(i)] |= bit;
+                    palabrasCiudad[ciudadDeFila(i)] |= bit;
+                    if (esDeclarante(i)) palabraDeclarantes |= bit;
+                }
+                for (size_t g = 0; g < numGrupos; ++g) grupos_[g].palabras()[w] = palabrasGrupo[g];
+                for (size_t c = 0; c < numCiudades; ++c) ciudades_[c].palabras()[w] = palabrasCiudad[c];
+                declarantes_.palabras()[w] = palabraDeclarantes;
+            }
+        });
+        filasIndexadas_ = n;
+    }
+
+    // true si los mapas describen exactamente 'n' filas (si no, hay que recorrer las columnas)
+    bool vigentePara(size_t n) const { return !grupos_.empty() && filasIndexadas_ == n; }
+
+    size_t numCiudades() const { return ciudades_.size(); }
+    size_t numGrupos() const { return grupos_.size(); }
+
+    const MapaBits& grupo(size_t g) const { return grupos_[g]; }
+    const MapaBits& ciudad(size_t c) const { return ciudades_[c]; }
+    const MapaBits& declarantes() const { return declarantes_; }
+
+private:
+    std::vector<MapaBits> grupos_;   // Por índice de grupo
+    std::vector<MapaBits> ciudades_; // Por código de ciudad
+    MapaBits declarantes_;
+    size_t filasIndexadas_;          // Filas de las columnas cuando se construyó
+};
+
+#endif // MAPA_BITS_H
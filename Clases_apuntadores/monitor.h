@@ -2,21 +2,36 @@
 #define MONITOR_H
 
 #include <chrono>
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <iostream>
 #include <fstream>
 #include <functional>  // std::function
+#include "instrumentacion.h"
 
 /**
- * Clase para monitorear el rendimiento (tiempo y memoria).
+ * Clase para monitorear el rendimiento (tiempo, memoria y, opcionalmente, contadores de hardware).
  * 
  * POR QUÉ: Cuantificar el rendimiento de las operaciones.
- * CÓMO: Midiendo tiempo con chrono y memoria con /proc/self/statm (Linux).
+ * CÓMO: Midiendo tiempo con chrono y memoria con /proc/self/statm (Linux). Con
+ *       activar_contadores(), iniciar_tiempo()/detener_tiempo() también leen ciclos,
+ *       instrucciones y fallos de caché, de predicción y de TLB con perf_event_open. En la
+ *       compilación instrumentada (ver instrumentacion.h) también cuentan copias,
+ *       movimientos y reservas de memoria.
  * PARA QUÉ: Optimización y análisis de rendimiento.
  */
 class Monitor {
 public:
+    // Contadores de hardware que se leen con perf_event_open (ver activar_contadores)
+    static const int NUM_CONTADORES = 6;
+    static const char* const NOMBRES_CONTADORES[NUM_CONTADORES];
+
+    Monitor();
+    ~Monitor();
+    Monitor(const Monitor&) = delete;            // Los descriptores de perf no se comparten
+    Monitor& operator=(const Monitor&) = delete;
+
     void iniciar_tiempo();
     double detener_tiempo();
     long obtener_memoria();
@@ -27,11 +42,23 @@ public:
 
     // Medir memoria consumida por una función, aisladamente (proceso hijo)
     long medir_memoria_funcion_kb(const std::function<void()>& fn);
+    // Igual, y 'resultado' recibe el texto que devolvió fn en el hijo (p. ej. un conteo)
+    long medir_memoria_funcion_kb(const std::function<std::string()>& fn, std::string& resultado);
     
+    bool activar_contadores();
+    void desactivar_contadores();
+    bool contadores_activos() const { return contadores_activos_; }
+
+    // Modo benchmark: cada consulta se repite 'repeticiones' veces tras 'calentamiento'
+    // ejecuciones sin medir (repeticiones <= 1 lo desactiva)
+    void configurar_repeticiones(int repeticiones, int calentamiento);
+    int repeticiones() const { return repeticiones_; }
+    double medir_repeticiones(const std::string& operacion, const std::function<void()>& fn);
+
     void registrar(const std::string& operacion, double tiempo, long memoria);
     void mostrar_estadistica(const std::string& operacion, double tiempo, long memoria);
     void mostrar_resumen();
-    void exportar_csv(const std::string& nombre_archivo = "estadisticas.csv");
+    bool exportar_csv(const std::string& nombre_archivo = "estadisticas.csv");
 
 private:
     // Estructura para almacenar métricas de una operación
@@ -39,13 +66,27 @@ private:
         std::string operacion; // Nombre de la operación
         double tiempo;         // Tiempo en milisegundos
         long memoria;          // Memoria en KB
+        long long contadores[NUM_CONTADORES]; // Lecturas de perf; -1 = no disponible
+        std::vector<double> muestras; // Tiempos de cada repetición (vacío si se midió una vez)
+        ConteoInstrumentacion instrumentacion; // Copias, movimientos y reservas (compilación instrumentada)
     };
+
+    void leer_contadores();
     
     std::chrono::high_resolution_clock::time_point inicio; // Punto de inicio del cronómetro
     std::vector<Registro> registros; // Historial de registros
     double total_tiempo = 0;         // Tiempo total acumulado
     long max_memoria = 0;            // Máximo de memoria utilizado
     long peak_before_kb_ = 0; // para delta de pico (mismo proceso)
+    int fds_contadores_[NUM_CONTADORES];          // -1 si el contador no se pudo abrir
+    uint64_t base_contadores_[NUM_CONTADORES][3];  // Lectura en iniciar_tiempo(): valor, habilitado, contando
+    long long ultimos_contadores_[NUM_CONTADORES]; // Lectura de la última medición
+    ConteoInstrumentacion base_instrumentacion_;   // Lectura en iniciar_tiempo()
+    ConteoInstrumentacion instrumentacion_hijos_;  // Lo contado por los hijos de medir_memoria_funcion_kb
+    ConteoInstrumentacion ultima_instrumentacion_; // Diferencia de la última medición
+    bool contadores_activos_ = false;
+    int repeticiones_ = 0;
+    int calentamiento_ = 0;
 };
 
 #endif // MONITOR_H
\ No newline at end of file
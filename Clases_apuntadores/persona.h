@@ -1,10 +1,18 @@
 #ifndef PERSONA_H
 #define PERSONA_H
 
+#include "arena.h"
+#include "diccionario.h"
+#include "fecha.h"
+#include "instrumentacion.h"
+#include <cstdint>
 #include <string>
+#include <vector>
 #include <iostream>
 #include <iomanip>
 
+class BufferTexto; // salida.h
+
 /**
  * Clase que representa una persona con datos personales y financieros.
  * 
@@ -14,16 +22,19 @@
  */
 class Persona {
 private:
-    std::string nombre;           // Nombre de pila
-    std::string apellido;         // Apellidos
-    std::string id;               // Identificador único (cédula)
-    std::string ciudadNacimiento; // Ciudad de nacimiento
-    std::string fechaNacimiento;  // Fecha de nacimiento en formato DD/MM/AAAA
+    CodigoCadena nombre;          // Nombre de pila (código en diccionarioNombres())
+    CodigoCadena apellido;        // Apellidos (código en diccionarioApellidos())
+    uint64_t id;                  // Identificador único (cédula numérica)
+    CodigoCadena ciudadNacimiento; // Ciudad de nacimiento (código en diccionarioCiudades())
+    FechaAAAAMMDD fechaNacimiento; // Fecha de nacimiento como entero AAAAMMDD
     double ingresosAnuales;       // Ingresos anuales en pesos colombianos
     double patrimonio;            // Patrimonio total (activos)
     double deudas;                // Deudas totales (pasivos)
     bool declaranteRenta;         // Si es declarante de renta
     char grupoDeclaracion;        // Grupo de declaracion
+#ifdef INSTRUMENTAR
+    InstrumentoCopias instrumento; // Cuenta copias y movimientos (ver instrumentacion.h)
+#endif
 
 public:
     /**
@@ -33,22 +44,40 @@ public:
      * CÓMO: Recibe cada atributo por valor y los mueve a los miembros correspondientes.
      * PARA QUÉ: Construir objetos Persona completos y válidos.
      */
-    Persona(std::string nom, std::string ape, std::string id, 
+    Persona(std::string nom, std::string ape, uint64_t id, 
             std::string ciudad, std::string fecha, double ingresos, 
             double patri, double deud, bool declara, char grupoDeclaracion);
+
+    /**
+     * Constructor a partir de códigos de diccionario ya calculados.
+     * 
+     * POR QUÉ: El constructor con textos tiene que buscarlos en los diccionarios (con mutex).
+     * CÓMO: Guarda los códigos y la fecha AAAAMMDD tal cual; el llamador garantiza que existen.
+     * PARA QUÉ: Que la generación (también la paralela) no toque los diccionarios.
+     */
+    Persona(CodigoCadena nom, CodigoCadena ape, uint64_t id,
+            CodigoCadena ciudad, FechaAAAAMMDD fecha, double ingresos,
+            double patri, double deud, bool declara, char grupoDeclaracion);
     
-    // Métodos de acceso (getters) - Implementados inline para eficiencia
-    std::string getNombre() const { return nombre; }
-    std::string getApellido() const { return apellido; }
-    std::string getId() const { return id; }
-    std::string getCiudadNacimiento() const { return ciudadNacimiento; }
-    std::string getFechaNacimiento() const { return fechaNacimiento; }
+    // Métodos de acceso (getters) - Implementados inline para eficiencia.
+    // Los textos se devuelven por referencia al diccionario, que no los mueve ni los borra:
+    // leerlos no reserva memoria ni copia el string (copiar solo si se va a modificar).
+    const std::string& getNombre() const { return diccionarioNombres().texto(nombre); }
+    const std::string& getApellido() const { return diccionarioApellidos().texto(apellido); }
+    uint64_t getId() const { return id; }
+    const std::string& getCiudadNacimiento() const { return diccionarioCiudades().texto(ciudadNacimiento); }
+    FechaAAAAMMDD getFechaNacimiento() const { return fechaNacimiento; } // AAAAMMDD (formatearFecha() para imprimir)
     double getIngresosAnuales() const { return ingresosAnuales; }
     double getPatrimonio() const { return patrimonio; }
     double getDeudas() const { return deudas; }
     bool getDeclaranteRenta() const { return declaranteRenta; }
     char getGrupoDeclaracion () const {return grupoDeclaracion;}
 
+    // Códigos de diccionario (para agrupar sin comparar textos)
+    CodigoCadena getCodigoNombre() const { return nombre; }
+    CodigoCadena getCodigoApellido() const { return apellido; }
+    CodigoCadena getCodigoCiudad() const { return ciudadNacimiento; }
+
     /**
      * Muestra toda la información de la persona de forma detallada.
      * 
@@ -66,6 +95,18 @@ public:
      * PARA QUÉ: Visualización eficiente en colecciones grandes.
      */
     void mostrarResumen() const;
+
+    /**
+     * Agrega el resumen de mostrarResumen() a un búfer de salida, sin pasar por std::cout.
+     *
+     * POR QUÉ: Listar millones de personas con iostream es más lento que generarlas.
+     * CÓMO: Copia los textos de los diccionarios y convierte ID e ingresos con BufferTexto.
+     * PARA QUÉ: Usarlo con escribirRegistros() en la opción 1 (mismo texto, sin salto de línea).
+     */
+    void formatearResumen(BufferTexto& salida) const;
 };
 
+// Colección de personas de un conjunto de datos; su memoria vive en una arena propia (ver arena.h)
+typedef std::vector<Persona, AsignadorArena<Persona>> ColeccionPersonas;
+
 #endif // PERSONA_H
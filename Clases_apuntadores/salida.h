@@ -0,0 +1,115 @@
+#ifndef SALIDA_H
+#define SALIDA_H
+
+#include "paralelo.h"
+#include <algorithm> // std::max, std::min
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/**
+ * Búfer de texto de solo agregar con conversiones numéricas propias.
+ *
+ * POR QUÉ: Listar millones de personas con std::cout pasa la mayor parte del tiempo en
+ *          la maquinaria de iostream (locale, manipuladores, una llamada por campo).
+ * CÓMO: Los campos se copian a un arreglo de char que se reutiliza; los enteros se
+ *       convierten con divisiones por 10 y los importes con dos decimales redondeando
+ *       el valor por 100 a entero (con respaldo a snprintf en los casos dudosos, para
+ *       dar exactamente el mismo texto que std::fixed << std::setprecision(2)).
+ * PARA QUÉ: Formatear registros sin tocar std::cout y escribirlos en bloques grandes.
+ */
+class BufferTexto {
+public:
+    void agregar(const char* texto, size_t n) { datos.insert(datos.end(), texto, texto + n); }
+    void agregar(const std::string& texto) { agregar(texto.data(), texto.size()); }
+    void agregar(const char* texto);
+    void agregar(char c) { datos.push_back(c); }
+    void agregarEntero(uint64_t valor);
+    void agregarDecimal2(double valor); // Como std::fixed << std::setprecision(2)
+
+    const char* data() const { return datos.data(); }
+    size_t size() const { return datos.size(); }
+    void limpiar() { datos.clear(); } // Conserva la capacidad para el siguiente bloque
+
+private:
+    std::vector<char> datos;
+};
+
+// Escribe los n bytes con write(2), repitiendo si la escritura es parcial; false si falla
+bool escribirTodo(int fd, const char* datos, size_t n);
+
+// Filas que formatea cada hilo por ronda y bytes acumulados antes de escribir en modo secuencial
+const size_t FILAS_POR_BLOQUE_SALIDA = size_t(1) << 16;
+const size_t BYTES_POR_ESCRITURA = size_t(1) << 20;
+
+// Hilos con que los listados llaman a escribirRegistros: 1 (por omisión) = secuencial,
+// 0 = todos los núcleos. Lo cambian la opción 19 del menú y el comando output_threads,
+// que rechazan más de MAXIMO_HILOS_SALIDA
+const unsigned MAXIMO_HILOS_SALIDA = 1024;
+unsigned hilosSalida();
+void fijarHilosSalida(unsigned hilos);
+
+/**
+ * Formatea las filas [0, n) y las escribe en la salida estándar en orden.
+ *
+ * POR QUÉ: Las opciones de listado escriben una línea por persona.
+ * CÓMO: Con un hilo, formatear(fila, buffer) llena un único BufferTexto que se escribe
+ *       con un write(2) cada BYTES_POR_ESCRITURA. Con varios, las filas se procesan en
+ *       rondas de hilos * FILAS_POR_BLOQUE_SALIDA: cada hilo formatea un tramo contiguo
+ *       en su propio búfer (ejecutarEnBloques) y luego los búferes se escriben en orden
+ *       de tramo, así que la salida es idéntica a la secuencial. std::cout se vacía antes
+ *       para que lo impreso con él quede antes del listado. Cada hilo recibe al menos
+ *       FILAS_POR_BLOQUE_SALIDA filas, así que los listados cortos no crean hilos.
+ * PARA QUÉ: Volcar millones de registros al ritmo del disco o la terminal.
+ *
+ * @param hilos 1 = secuencial; 0 = todos los núcleos. Los listados pasan hilosSalida().
+ * @param formatear Función (size_t fila, BufferTexto&) -> bool; true si la fila se escribió.
+ * @return Número de filas para las que formatear devolvió true.
+ */
+template <typename Formatear>
+size_t escribirRegistros(size_t n, unsigned hilos, Formatear formatear) {
+    std::cout.flush();
+    hilos = hilosEfectivos(hilos);
+    const size_t maximoHilos = std::max<size_t>(1, n / FILAS_POR_BLOQUE_SALIDA);
+    if (hilos > maximoHilos) hilos = static_cast<unsigned>(maximoHilos);
+    size_t escritas = 0;
+
+    if (hilos == 1) {
+        BufferTexto buffer;
+        for (size_t i = 0; i < n; ++i) {
+            if (formatear(i, buffer)) ++escritas;
+            if (buffer.size() >= BYTES_POR_ESCRITURA) {
+                escribirTodo(1, buffer.data(), buffer.size());
+                buffer.limpiar();
+            }
+        }
+        escribirTodo(1, buffer.data(), buffer.size());
+        return escritas;
+    }
+
+    std::vector<BufferTexto> buffers(hilos);
+    std::vector<size_t> conteos(hilos);
+    const size_t filasPorRonda = hilos * FILAS_POR_BLOQUE_SALIDA;
+    for (size_t base = 0; base < n; base += filasPorRonda) {
+        const size_t filas = std::min(filasPorRonda, n - base);
+        ejecutarEnBloques(filas, hilos, [&](size_t inicio, size_t fin, unsigned bloque) {
+            BufferTexto& buffer = buffers[bloque];
+            size_t conteo = 0;
+            for (size_t i = base + inicio; i < base + fin; ++i) {
+                if (formatear(i, buffer)) ++conteo;
+            }
+            conteos[bloque] = conteo;
+        });
+        for (unsigned b = 0; b < hilos; ++b) {
+            escribirTodo(1, buffers[b].data(), buffers[b].size());
+            buffers[b].limpiar();
+            escritas += conteos[b];
+            conteos[b] = 0;
+        }
+    }
+    return escritas;
+}
+
+#endif // SALIDA_H
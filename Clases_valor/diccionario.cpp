@@ -0,0 +1,59 @@
+#include "diccionario.h"
+
+DiccionarioCadenas::DiccionarioCadenas() : cantidad(0) {
+    for (std::atomic<std::string*>& segmento : segmentos) segmento.store(nullptr, std::memory_order_relaxed);
+}
+
+DiccionarioCadenas::DiccionarioCadenas(const std::vector<std::string>& iniciales) : DiccionarioCadenas() {
+    // Cada texto conserva su posición aunque esté repetido en las tablas;
+    // codificar() devuelve el primer código de un texto repetido
+    std::lock_guard<std::mutex> bloqueo(mutex);
+    codigos.reserve(iniciales.size());
+    for (const std::string& texto : iniciales) codigos.emplace(texto, agregar(texto));
+}
+
+DiccionarioCadenas::~DiccionarioCadenas() {
+    for (std::atomic<std::string*>& segmento : segmentos) delete[] segmento.load(std::memory_order_relaxed);
+}
+
+CodigoCadena DiccionarioCadenas::agregar(const std::string& texto) {
+    const size_t codigo = cantidad.load(std::memory_order_relaxed);
+    size_t segmento, posicion;
+    ubicar(codigo, segmento, posicion);
+    std::string* textos = segmentos[segmento].load(std::memory_order_relaxed);
+    if (!textos) {
+        textos = new std::string[size_t(1) << (segmento + BITS_PRIMER_SEGMENTO)];
+        segmentos[segmento].store(textos, std::memory_order_release);
+    }
+    textos[posicion] = texto;
+    // Publica el texto: quien lea el nuevo tamaño ve el segmento y el texto ya escritos
+    cantidad.store(codigo + 1, std::memory_order_release);
+    return static_cast<CodigoCadena>(codigo);
+}
+
+/**
+ * Implementación de codificar.
+ *
+ * POR QUÉ: Un mismo texto debe recibir siempre el mismo código.
+ * CÓMO: Busca el texto en el mapa; si no está, lo escribe en la siguiente posición
+ *       libre de los segmentos y usa esa posición como código.
+ * PARA QUÉ: Internar textos que no estaban en las tablas de generación.
+ */
+CodigoCadena DiccionarioCadenas::codificar(const std::string& texto) {
+    std::lock_guard<std::mutex> bloqueo(mutex);
+
+    auto it = codigos.find(texto);
+    if (it != codigos.end()) return it->second;
+
+    const CodigoCadena codigo = agregar(texto);
+    codigos.emplace(texto, codigo);
+    return codigo;
+}
+
+bool DiccionarioCadenas::buscar(const std::string& texto, CodigoCadena& codigo) const {
+    std::lock_guard<std::mutex> bloqueo(mutex);
+    auto it = codigos.find(texto);
+    if (it == codigos.end()) return false;
+    codigo = it->second;
+    return true;
+}
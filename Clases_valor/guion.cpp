@@ -0,0 +1,387 @@
+#include "guion.h"
+#include "agregados.h"  // mostrarReporteCompleto, calcularTopK, contarEnRango
+#include "salida.h"     // escribirTodo
+#include <cctype>       // std::isspace, std::toupper
+#include <cerrno>
+#include <cstdio>       // std::snprintf, std::fflush
+#include <cmath>        // std::isfinite
+#include <cstdlib>      // std::strtoull, std::strtod
+#include <cstring>      // std::strcmp
+#include <fcntl.h>      // open
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <unistd.h>     // dup, dup2, close
+
+std::string ComandoGuion::texto() const {
+    std::string texto = nombre;
+    for (const std::string& argumento : argumentos) texto += " " + argumento;
+    return texto;
+}
+
+std::vector<ComandoGuion> separarComandos(const std::string& texto) {
+    std::vector<ComandoGuion> comandos;
+    std::string linea;
+    std::istringstream lineas(texto);
+    while (std::getline(lineas, linea)) {
+        const size_t comentario = linea.find('#');
+        if (comentario != std::string::npos) linea.erase(comentario);
+
+        std::string parte;
+        std::istringstream partes(linea);
+        while (std::getline(partes, parte, ';')) {
+            std::istringstream palabras(parte);
+            ComandoGuion comando;
+            std::string palabra;
+            if (!(palabras >> comando.nombre)) continue; // Comando vacío
+            while (palabras >> palabra) comando.argumentos.push_back(palabra);
+            comandos.push_back(comando);
+        }
+    }
+    return comandos;
+}
+
+void mostrarAyudaGuion(std::ostream& salida) {
+    salida << "Uso: programa [--verbose] [--script archivo] [\"comando; comando; ...\"]\n"
+              "Sin argumentos se abre el menú interactivo.\n\n"
+              "Datos:\n"
+              "  generate N [semilla] [hilos]   Crear N personas en paralelo (semilla 42, todos los núcleos)\n"
+              "  stream N [semilla] [hilos]     Agregar por ciudad N personas sin guardarlas\n"
+              "  load RUTA | save RUTA          Cargar/guardar instantánea binaria\n"
+              "  layout filas|columnas          Ejecutar las consultas sobre la variante por filas o sobre PersonaColumns\n"
+              "Medición:\n"
+              "  counters on|off                Contadores de hardware (perf)\n"
+              "  repeat N [calentamiento]       Repetir cada consulta N veces (N <= 1 desactiva)\n"
+              "  output_threads N               Hilos de los listados (1 por omisión = secuencial; 0 = todos)\n"
+              "  export RUTA.csv                Exportar las estadísticas registradas\n"
+              "Consultas:\n"
+              "  max_patrimonio | max_deuda | longeva\n"
+              "  by_city patrimonio|deuda|longeva\n"
+              "  by_group patrimonio|deuda\n"
+              "  group A|B|C                    Listar y contar un grupo\n"
+              "  city_group CIUDAD A|B|C        Listar y contar un grupo en una ciudad (siempre columnar)\n"
+              "  count_groups                   Contar cada grupo y los declarantes sin listar (siempre columnar)\n"
+              "  count A|B|C|N|* [declarante|no_declarante] [CIUDAD]\n"
+              "                                 Contar con filtros combinados (siempre columnar)\n"
+              "  top K ingresos|patrimonio|deuda|longeva [city|group|city_group]\n"
+              "                                 K mejores en total o por clave (siempre columnar)\n"
+              "  range_count ingresos|patrimonio|deuda MIN MAX\n"
+              "                                 Contar personas con el campo en [MIN, MAX] (siempre columnar)\n"
+              "  range ingresos|patrimonio|deuda MIN MAX\n"
+              "                                 Listarlas de menor a mayor valor (siempre columnar)\n"
+              "  percentile ingresos|patrimonio|deuda P\n"
+              "                                 Persona en el percentil P (0-100) del campo (siempre columnar)\n"
+              "  debt_ratio FRACCION            Contar personas con deudas > FRACCION x patrimonio (siempre columnar)\n"
+              "  top_group_by_city              Grupo con más personas por ciudad\n"
+              "  avg_patrimonio_by_city         3 ciudades con mayor promedio de patrimonio\n"
+              "  find ID                        Buscar persona por ID\n"
+              "  report                         Reporte completo en un recorrido (siempre columnar)\n\n"
+              "Salida: una línea por comando separada por tabuladores\n"
+              "(comando, estado, tiempo_ms, memoria_kb, detalle). En las consultas, 'detalle' lleva\n"
+              "el resultado breve: personas=N en los conteos, id=N (y valor=X en percentile) en las\n"
+              "que eligen una persona; vacío en las que solo imprimen una tabla. Código de salida 0 si todos\n"
+              "los comandos se ejecutaron, 1 si alguno falló (se detiene en el primero), 2 por error de uso.\n";
+}
+
+ModoEjecucion interpretarArgumentos(int argc, char* argv[], OpcionesGuion& opciones, int& codigoSalida) {
+    codigoSalida = 0;
+    if (argc <= 1) return ModoEjecucion::Interactivo;
+
+    std::string guion;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--help") == 0 || std::strcmp(argv[i], "-h") == 0) {
+            mostrarAyudaGuion(std::cout);
+            return ModoEjecucion::Terminar;
+        } else if (std::strcmp(argv[i], "--verbose") == 0 || std::strcmp(argv[i], "-v") == 0) {
+            opciones.detallado = true;
+        } else if (std::strcmp(argv[i], "--script") == 0 || std::strcmp(argv[i], "-f") == 0) {
+            if (i + 1 >= argc) {
+                std::cerr << "[guion] Falta el archivo después de " << argv[i] << "\n";
+                codigoSalida = 2;
+                return ModoEjecucion::Terminar;
+            }
+            std::ifstream archivo(argv[++i]);
+            if (!archivo) {
+                std::cerr << "[guion] No se pudo abrir " << argv[i] << "\n";
+                codigoSalida = 2;
+                return ModoEjecucion::Terminar;
+            }
+            std::ostringstream contenido;
+            contenido << archivo.rdbuf();
+            guion += contenido.str() + "\n";
+        } else {
+            guion += std::string(argv[i]) + " ";
+        }
+    }
+
+    opciones.comandos = separarComandos(guion);
+    if (opciones.comandos.empty()) {
+        std::cerr << "[guion] No hay comandos que ejecutar\n";
+        mostrarAyudaGuion(std::cerr);
+        codigoSalida = 2;
+        return ModoEjecucion::Terminar;
+    }
+    return ModoEjecucion::Guion;
+}
+
+bool leerEnteroGuion(const std::string& texto, unsigned long long& valor) {
+    if (texto.empty() || !std::isdigit(static_cast<unsigned char>(texto[0]))) return false;
+    char* fin = nullptr;
+    errno = 0;
+    valor = std::strtoull(texto.c_str(), &fin, 10);
+    return errno == 0 && *fin == '\0';
+}
+
+namespace {
+    // Número real finito (p. ej. "1e9" o "0.7"); false si sobra texto
+    bool leerRealGuion(const std::string& texto, double& valor) {
+        if (texto.empty()) return false;
+        char* fin = nullptr;
+        errno = 0;
+        valor = std::strtod(texto.c_str(), &fin);
+        return errno == 0 && *fin == '\0' && std::isfinite(valor);
+    }
+
+    // Consulta que solo imprime una tabla: sin resultado breve
+    template <typename Tabla>
+    ConsultaGuion soloTabla(Tabla tabla) {
+        return [tabla]{ tabla(); return std::string(); };
+    }
+
+    // Muestra la fila (si existe) y devuelve su ID como resultado breve
+    std::string mostrarFilaGuion(const PersonaColumns& columnas, size_t fila) {
+        if (fila >= columnas.size()) return std::string();
+        mostrarFila(columnas, fila);
+        return detalleIdGuion(columnas.id[fila]);
+    }
+
+    double valorCampoRango(const PersonaColumns& columnas, CampoAgregado campo, size_t fila) {
+        switch (campo) {
+            case CampoAgregado::Ingresos: return columnas.ingresosAnuales[fila];
+            case CampoAgregado::Deudas:   return columnas.deudas[fila];
+            default:                      return columnas.patrimonio[fila];
+        }
+    }
+
+    std::string textoDecimal2(double valor) {
+        char texto[64];
+        std::snprintf(texto, sizeof(texto), "%.2f", valor);
+        return texto;
+    }
+
+    // Campo con índice de rango: ingresos, patrimonio o deuda
+    bool leerCampoRangoGuion(const std::string& texto, CampoAgregado& campo) {
+        if (texto == "ingresos") campo = CampoAgregado::Ingresos;
+        else if (texto == "patrimonio") campo = CampoAgregado::Patrimonio;
+        else if (texto == "deuda") campo = CampoAgregado::Deudas;
+        else return false;
+        return true;
+    }
+}
+
+std::string detalleConteoGuion(size_t personas) {
+    return "personas=" + std::to_string(personas);
+}
+
+std::string detalleIdGuion(unsigned long long id) {
+    return "id=" + std::to_string(id);
+}
+
+ConsultaGuion consultaColumnarGuion(const ComandoGuion& comando, const PersonaColumns& columnas) {
+    const std::string& c = comando.nombre;
+    const std::string argumento = comando.argumentos.empty() ? "" : comando.argumentos[0];
+    const size_t n = comando.argumentos.size();
+
+    if (c == "max_patrimonio" && n == 0) return [&columnas]{ return mostrarFilaGuion(columnas, buscarMayorPatrimonio(columnas)); };
+    if (c == "max_deuda" && n == 0) return [&columnas]{ return mostrarFilaGuion(columnas, buscarMayorDeuda(columnas)); };
+    if (c == "longeva" && n == 0) {
+        return [&columnas]{ return mostrarFilaGuion(columnas, buscarPersonaMasLongevaConCondicion(columnas)); };
+    }
+    if (c == "by_city" && n == 1) {
+        if (argumento == "patrimonio") return soloTabla([&columnas]{ buscarMayoresPatrimonioPorCiudad(columnas); });
+        if (argumento == "deuda") return soloTabla([&columnas]{ buscarMayoresDeudasPorCiudad(columnas); });
+        if (argumento == "longeva") return soloTabla([&columnas]{ mostrarPersonasMasLongevaPorCiudad(columnas); });
+    }
+    if (c == "by_group" && n == 1) {
+        if (argumento == "patrimonio") return soloTabla([&columnas]{ buscarMayoresPatrimonioPorGrupo(columnas); });
+        if (argumento == "deuda") return soloTabla([&columnas]{ buscarMayoresDeudasPorGrupo(columnas); });
+    }
+    if (c == "group" && n == 1 && argumento.size() == 1) {
+        const char grupo = static_cast<char>(std::toupper(static_cast<unsigned char>(argumento[0])));
+        if (grupo == 'A' || grupo == 'B' || grupo == 'C') {
+            return [&columnas, grupo]{
+                int conteo = 0;
+                listarPersonasGrupo(columnas, grupo, &conteo);
+                std::cout << "\nAl grupo " << grupo << " pertenecen " << conteo << " personas\n";
+                return detalleConteoGuion(static_cast<size_t>(conteo));
+            };
+        }
+    }
+    if (c == "city_group" && n >= 2 && comando.argumentos.back().size() == 1) {
+        // La ciudad puede tener espacios ("Santa Marta"): son todos los argumentos menos el último
+        std::string nombreCiudad = comando.argumentos[0];
+        for (size_t i = 1; i + 1 < n; ++i) nombreCiudad += " " + comando.argumentos[i];
+        const char grupo = static_cast<char>(std::toupper(static_cast<unsigned char>(comando.argumentos.back()[0])));
+        CodigoCadena ciudad;
+        if (diccionarioCiudades().buscar(nombreCiudad, ciudad) && (grupo == 'A' || grupo == 'B' || grupo == 'C')) {
+            return [&columnas, ciudad, grupo]{
+                int conteo = 0;
+                listarPersonasCiudadGrupo(columnas, ciudad, grupo, &conteo);
+                std::cout << "\nAl grupo " << grupo << " en " << diccionarioCiudades().texto(ciudad)
+                          << " pertenecen " << conteo << " personas\n";
+                return detalleConteoGuion(static_cast<size_t>(conteo));
+            };
+        }
+    }
+    if (c == "count_groups" && n == 0) return soloTabla([&columnas]{ mostrarConteoPorGrupo(columnas); });
+    if (c == "count" && n >= 1 && argumento.size() == 1) {
+        // count GRUPO [declarante|no_declarante] [CIUDAD con espacios]
+        const char letra = static_cast<char>(std::toupper(static_cast<unsigned char>(argumento[0])));
+        FiltroConteo filtro{-1, -1, -1};
+        if (letra != '*') {
+            if (letra != 'A' && letra != 'B' && letra != 'C' && letra != 'N') return ConsultaGuion();
+            filtro.grupo = indiceGrupoConN(letra);
+        }
+        size_t siguiente = 1;
+        if (siguiente < n && (comando.argumentos[siguiente] == "declarante" ||
+                              comando.argumentos[siguiente] == "no_declarante")) {
+            filtro.declarante = comando.argumentos[siguiente] == "declarante" ? 1 : 0;
+            ++siguiente;
+        }
+        if (siguiente < n) {
+            std::string nombreCiudad = comando.argumentos[siguiente];
+            for (size_t i = siguiente + 1; i < n; ++i) nombreCiudad += " " + comando.argumentos[i];
+            CodigoCadena ciudad;
+            if (!diccionarioCiudades().buscar(nombreCiudad, ciudad)) return ConsultaGuion();
+            filtro.ciudad = static_cast<int>(ciudad);
+        }
+        return [&columnas, filtro]{
+            const size_t conteo = contarPersonas(columnas, filtro);
+            std::cout << conteo << "\n";
+            return detalleConteoGuion(conteo);
+        };
+    }
+    unsigned long long k;
+    if (c == "top" && (n == 2 || n == 3) && leerEnteroGuion(argumento, k) && k > 0) {
+        // top K CAMPO [AGRUPACION]
+        const std::string& nombreCampo = comando.argumentos[1];
+        CampoAgregado campo;
+        if (nombreCampo == "ingresos") campo = CampoAgregado::Ingresos;
+        else if (nombreCampo == "patrimonio") campo = CampoAgregado::Patrimonio;
+        else if (nombreCampo == "deuda") campo = CampoAgregado::Deudas;
+        else if (nombreCampo == "longeva") campo = CampoAgregado::FechaNacimiento;
+        else return ConsultaGuion();
+
+        AgrupacionAgregado agrupacion = AgrupacionAgregado::Total;
+        if (n == 3) {
+            const std::string& nombreAgrupacion = comando.argumentos[2];
+            if (nombreAgrupacion == "city") agrupacion = AgrupacionAgregado::Ciudad;
+            else if (nombreAgrupacion == "group") agrupacion = AgrupacionAgregado::Grupo;
+            else if (nombreAgrupacion == "city_group") agrupacion = AgrupacionAgregado::CiudadYGrupo;
+            else return ConsultaGuion();
+        }
+        return soloTabla([&columnas, campo, agrupacion, k]{
+            mostrarTopK(columnas, calcularTopK(columnas, campo, agrupacion, static_cast<size_t>(k)));
+        });
+    }
+    CampoAgregado campoRango;
+    double minimo, maximo;
+    if ((c == "range_count" || c == "range") && n == 3 && leerCampoRangoGuion(argumento, campoRango) &&
+        leerRealGuion(comando.argumentos[1], minimo) && leerRealGuion(comando.argumentos[2], maximo)) {
+        // range_count|range CAMPO MIN MAX
+        if (c == "range_count") {
+            return [&columnas, campoRango, minimo, maximo]{
+                const size_t conteo = contarEnRango(columnas, campoRango, minimo, maximo);
+                std::cout << conteo << "\n";
+                return detalleConteoGuion(conteo);
+            };
+        }
+        return [&columnas, campoRango, minimo, maximo]{
+            const size_t listadas = listarEnRango(columnas, campoRango, minimo, maximo);
+            std::cout << "\nEn el rango hay " << listadas << " personas\n";
+            return detalleConteoGuion(listadas);
+        };
+    }
+    double percentil;
+    if (c == "percentile" && n == 2 && leerCampoRangoGuion(argumento, campoRango) &&
+        leerRealGuion(comando.argumentos[1], percentil) && percentil >= 0 && percentil <= 100) {
+        return [&columnas, campoRango, percentil]{
+            const size_t fila = filaPercentil(columnas, campoRango, percentil);
+            std::string detalle = mostrarFilaGuion(columnas, fila);
+            if (!detalle.empty()) detalle += " valor=" + textoDecimal2(valorCampoRango(columnas, campoRango, fila));
+            return detalle;
+        };
+    }
+    double fraccion;
+    if (c == "debt_ratio" && n == 1 && leerRealGuion(argumento, fraccion) && fraccion >= 0) {
+        return [&columnas, fraccion]{
+            const size_t conteo = contarDeudaSobrePatrimonio(columnas, fraccion);
+            std::cout << conteo << "\n";
+            return detalleConteoGuion(conteo);
+        };
+    }
+    if (c == "top_group_by_city" && n == 0) return soloTabla([&columnas]{ calcularGrupoMayorPorCiudad(columnas); });
+    if (c == "avg_patrimonio_by_city" && n == 0) return soloTabla([&columnas]{ calcularPromedioPatrimonio(columnas); });
+    unsigned long long id;
+    if (c == "find" && n == 1 && leerEnteroGuion(argumento, id)) {
+        return [&columnas, id]{
+            const size_t fila = buscarPorID(columnas, id);
+            if (fila == FILA_INVALIDA) std::cout << "No se encontró persona con ID " << id << "\n";
+            return mostrarFilaGuion(columnas, fila);
+        };
+    }
+    if (c == "report" && n == 0) return soloTabla([&columnas]{ mostrarReporteCompleto(columnas); });
+    return ConsultaGuion();
+}
+
+bool esConsultaSoloColumnar(const std::string& nombre) {
+    return nombre == "report" || nombre == "city_group" || nombre == "count_groups" || nombre == "count" ||
+           nombre == "top" || nombre == "range_count" || nombre == "range" || nombre == "percentile" ||
+           nombre == "debt_ratio";
+}
+
+bool indiceColumnarGuion(const ComandoGuion& comando, IndiceColumnar& indice) {
+    const std::string& c = comando.nombre;
+    CampoAgregado campo;
+    if (c == "group" || c == "city_group" || c == "top_group_by_city") indice = IndiceColumnar::CiudadGrupo;
+    else if (c == "count" || c == "count_groups") indice = IndiceColumnar::MapasBits;
+    else if ((c == "range_count" || c == "range" || c == "percentile") && !comando.argumentos.empty() &&
+             leerCampoRangoGuion(comando.argumentos[0], campo)) indice = indiceRangoDeCampo(campo);
+    else return false;
+    return true;
+}
+
+ResultadosGuion::ResultadosGuion(bool detallado) {
+    std::cout.flush();
+    std::fflush(stdout);
+    fd_resultados_ = dup(STDOUT_FILENO);
+    if (!detallado && fd_resultados_ >= 0) {
+        const int nulo = open("/dev/null", O_WRONLY);
+        if (nulo >= 0) {
+            dup2(nulo, STDOUT_FILENO);
+            close(nulo);
+        }
+    }
+    escribir("comando\testado\ttiempo_ms\tmemoria_kb\tdetalle\n");
+}
+
+ResultadosGuion::~ResultadosGuion() {
+    std::cout.flush();
+    std::fflush(stdout);
+    if (fd_resultados_ >= 0) {
+        dup2(fd_resultados_, STDOUT_FILENO);
+        close(fd_resultados_);
+    }
+}
+
+void ResultadosGuion::informar(const ComandoGuion& comando, bool correcto, double tiempo_ms, long memoria_kb,
+                               const std::string& detalle) {
+    char numeros[64];
+    std::snprintf(numeros, sizeof(numeros), "\t%.6f\t%ld\t", tiempo_ms, memoria_kb);
+    escribir(comando.texto() + (correcto ? "\tok" : "\terror") + numeros + detalle + "\n");
+}
+
+void ResultadosGuion::escribir(const std::string& linea) {
+    std::cout.flush(); // En modo detallado, lo impreso por la consulta va antes de su resultado
+    escribirTodo(fd_resultados_ >= 0 ? fd_resultados_ : STDOUT_FILENO, linea.data(), linea.size());
+}
@@ -0,0 +1,155 @@
+#ifndef INDICE_CIUDAD_GRUPO_H
+#define INDICE_CIUDAD_GRUPO_H
+
+#include "paralelo.h"
+#include <cstddef>
+#include <cstdint>
+#include <functional> // std::greater
+#include <queue>
+#include <utility>
+#include <vector>
+
+/**
+ * Índice secundario (ciudad, grupo) -> filas, en formato CSR (listas contiguas).
+ *
+ * POR QUÉ: Listar un grupo, contar personas por (ciudad, grupo) o pedir "el grupo B de
+ *          Cali" recorría las 10M filas aunque solo interesara una fracción.
+ * CÓMO: Un ordenamiento por conteo en dos pasadas paralelas. Cada hilo cuenta las filas
+ *       de cada clave (ciudad * numGrupos + grupo) en su bloque; las sumas prefijas dan
+ *       el inicio de cada clave en 'filas' y, dentro de ella, el de cada bloque. En la
+ *       segunda pasada cada hilo escribe sus filas en su tramo. Así las filas de cada
+ *       clave quedan en orden ascendente, igual que en un recorrido secuencial, y
+ *       'inicios[k + 1] - inicios[k]' es el conteo de la clave sin leer las filas.
+ * PARA QUÉ: Que las consultas filtradas por ciudad y/o grupo lean solo las filas que
+ *           cumplen el filtro, y los conteos por (ciudad, grupo) cuesten O(claves).
+ *
+ * Las filas se guardan en 32 bits (la mitad de memoria que size_t); con más de
+ * 2^32 - 1 filas el índice queda sin construir y las consultas recorren las columnas.
+ */
+class IndiceCiudadGrupo {
+public:
+    // Filas de una clave: [inicio, fin) en orden ascendente
+    struct Rango {
+        const uint32_t* inicio;
+        const uint32_t* fin;
+
+        const uint32_t* begin() const { return inicio; }
+        const uint32_t* end() const { return fin; }
+        size_t size() const { return static_cast<size_t>(fin - inicio); }
+        bool empty() const { return inicio == fin; }
+    };
+
+    IndiceCiudadGrupo() : numCiudades_(0), numGrupos_(0), filasIndexadas_(0) {}
+
+    /**
+     * Construye el índice a partir de las funciones fila -> ciudad y fila -> grupo.
+     *
+     * @param n Número de filas.
+     * @param ciudadDeFila Función (size_t) -> código de ciudad en [0, numCiudades).
+     * @param grupoDeFila Función (size_t) -> índice de grupo en [0, numGrupos).
+     * @param hilos Hilos a usar (0 = todos los núcleos).
+     */
+    template <typename CiudadDeFila, typename GrupoDeFila>
+    void construir(size_t n, size_t numCiudades, size_t numGrupos, CiudadDeFila ciudadDeFila,
+                   GrupoDeFila grupoDeFila, unsigned hilos = 0) {
+        *this = IndiceCiudadGrupo();
+        if (n > UINT32_MAX) return;
+
+        const size_t numClaves = numCiudades * numGrupos;
+        auto claveDeFila = [&](size_t i) { return ciudadDeFila(i) * numGrupos + grupoDeFila(i); };
+
+        // Pasada 1: conteo por bloque y clave
+        hilos = hilosEfectivos(hilos);
+        const size_t maximoHilos = std::max<size_t>(1, n / FILAS_MINIMAS_POR_HILO);
+        if (hilos > maximoHilos) hilos = static_cast<unsigned>(maximoHilos);
+        std::vector<std::vector<size_t>> conteos(hilos, std::vector<size_t>(numClaves, 0));
+        ejecutarEnBloques(n, hilos, [&](size_t inicio, size_t fin, unsigned bloque) {
+            std::vector<size_t>& conteo = conteos[bloque];
+            for (size_t i = inicio; i < fin; ++i) conteo[claveDeFila(i)]++;
+        });
+
+        // Sumas prefijas: inicio de cada clave y, dentro de ella, posición de escritura de cada bloque
+        inicios_.assign(numClaves + 1, 0);
+        for (size_t k = 0, total = 0; k < numClaves; ++k) {
+            inicios_[k] = total;
+            for (std::vector<size_t>& conteo : conteos) {
+                const size_t filasBloque = conteo[k];
+                conteo[k] = total;
+                total += filasBloque;
+            }
+        }
+        inicios_[numClaves] = n;
+
+        // Pasada 2: cada bloque escribe sus filas en su tramo de cada clave
+        filas_.resize(n);
+        ejecutarEnBloques(n, hilos, [&](size_t inicio, size_t fin, unsigned bloque) {
+            std::vector<size_t>& siguiente = conteos[bloque];
+            for (size_t i = inicio; i < fin; ++i) filas_[siguiente[claveDeFila(i)]++] = static_cast<uint32_t>(i);
+        });
+
+        numCiudades_ = numCiudades;
+        numGrupos_ = numGrupos;
+        filasIndexadas_ = n;
+    }
+
+    // true si el índice describe exactamente 'n' filas (si no, hay que recorrer las columnas)
+    bool vigentePara(size_t n) const { return !inicios_.empty() && filasIndexadas_ == n; }
+
+    size_t numCiudades() const { return numCiudades_; }
+    size_t numGrupos() const { return numGrupos_; }
+
+    // Filas de la ciudad y el grupo dados, en orden ascendente
+    Rango filas(size_t ciudad, size_t grupo) const {
+        const size_t k = ciudad * numGrupos_ + grupo;
+        return Rango{filas_.data() + inicios_[k], filas_.data() + inicios_[k + 1]};
+    }
+
+    // Número de filas de la ciudad y el grupo dados, sin leerlas
+    size_t contar(size_t ciudad, size_t grupo) const {
+        const size_t k = ciudad * numGrupos_ + grupo;
+        return inicios_[k + 1] - inicios_[k];
+    }
+
+    // Número de filas de la ciudad dada (todos los grupos son contiguos)
+    size_t contarCiudad(size_t ciudad) const {
+        return inicios_[(ciudad + 1) * numGrupos_] - inicios_[ciudad * numGrupos_];
+    }
+
+    /**
+     * Filas de un grupo en todas las ciudades, en orden ascendente.
+     *
+     * CÓMO: Las listas de cada ciudad ya están ordenadas; se mezclan con un montículo de
+     *       numCiudades cursores, leyendo solo las filas del grupo.
+     */
+    std::vector<uint32_t> filasDeGrupo(size_t grupo) const {
+        typedef std::pair<uint32_t, size_t> Cursor; // (fila actual, ciudad)
+        std::priority_queue<Cursor, std::vector<Cursor>, std::greater<Cursor>> siguientes;
+        std::vector<const uint32_t*> posiciones(numCiudades_);
+        size_t total = 0;
+        for (size_t c = 0; c < numCiudades_; ++c) {
+            Rango rango = filas(c, grupo);
+            posiciones[c] = rango.inicio;
+            total += rango.size();
+            if (!rango.empty()) siguientes.push(Cursor(*rango.inicio, c));
+        }
+
+        std::vector<uint32_t> resultado;
+        resultado.reserve(total);
+        while (!siguientes.empty()) {
+            const size_t c = siguientes.top().second;
+            resultado.push_back(siguientes.top().first);
+            siguientes.pop();
+            if (++posiciones[c] != filas(c, grupo).fin) siguientes.push(Cursor(*posiciones[c], c));
+        }
+        return resultado;
+    }
+
+private:
+    std::vector<size_t> inicios_; // Clave -> primera posición en filas_ (numClaves + 1 entradas)
+    std::vector<uint32_t> filas_; // Filas agrupadas por clave, ascendentes dentro de cada una
+    size_t numCiudades_;
+    size_t numGrupos_;
+    size_t filasIndexadas_;       // Filas de las columnas cuando se construyó
+};
+
+#endif // INDICE_CIUDAD_GRUPO_H
@@ -0,0 +1,79 @@
+#ifndef INDICE_ID_H
+#define INDICE_ID_H
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+
+// Valor devuelto por las búsquedas por fila cuando no hay resultado
+const size_t FILA_INVALIDA = static_cast<size_t>(-1);
+
+/**
+ * Índice de ID -> fila con acceso directo cuando los IDs son consecutivos.
+ *
+ * POR QUÉ: Los IDs salen de un contador (1000000000, 1000000001, ...), así que la fila
+ *          de un ID es simplemente id - base. Buscar con lower_bound cuesta log2(n)
+ *          comparaciones (y antes, copias de std::string) por cada consulta.
+ * CÓMO: construir() recorre los IDs una vez. Si todos cumplen id[i] == base + i el índice
+ *       queda "denso" y buscar() es una resta y una comprobación de rango. Si algún ID
+ *       rompe la secuencia (registros borrados o insertados fuera de orden) se llena
+ *       una tabla hash ID -> fila y buscar() la consulta.
+ * PARA QUÉ: Búsquedas por ID en O(1) para el flujo interactivo, con la misma interfaz
+ *           sin importar cómo estén ordenados los registros.
+ */
+class IndiceID {
+public:
+    IndiceID() : base(0), cantidad(0), denso(true) {}
+
+    /**
+     * Construye el índice a partir de una función fila -> ID.
+     *
+     * @param n Número de filas.
+     * @param idDeFila Función (size_t) -> uint64_t con el ID de cada fila.
+     */
+    template <typename ObtenerID>
+    void construir(size_t n, ObtenerID idDeFila) {
+        base = n > 0 ? idDeFila(size_t(0)) : 0;
+        cantidad = n;
+        denso = true;
+        posiciones.clear();
+
+        for (size_t i = 0; i < n; ++i) {
+            if (idDeFila(i) != base + i) {
+                denso = false;
+                break;
+            }
+        }
+        if (denso) return;
+
+        // Respaldo: tabla hash (si un ID se repite, gana la primera fila)
+        posiciones.reserve(n);
+        for (size_t i = 0; i < n; ++i) {
+            posiciones.emplace(idDeFila(i), i);
+        }
+    }
+
+    // Fila del ID dado, o FILA_INVALIDA si no existe
+    size_t buscar(uint64_t id) const {
+        if (denso) {
+            // Con id < base la resta da la vuelta y también queda fuera de rango
+            const uint64_t desplazamiento = id - base;
+            return desplazamiento < cantidad ? static_cast<size_t>(desplazamiento) : FILA_INVALIDA;
+        }
+        auto it = posiciones.find(id);
+        return it != posiciones.end() ? it->second : FILA_INVALIDA;
+    }
+
+    // true si se usa el acceso directo (IDs consecutivos)
+    bool esDenso() const { return denso; }
+
+    size_t size() const { return cantidad; }
+
+private:
+    uint64_t base;                                 // ID de la fila 0
+    size_t cantidad;                               // Número de filas indexadas
+    bool denso;                                    // IDs consecutivos desde 'base'
+    std::unordered_map<uint64_t, size_t> posiciones; // Respaldo cuando no es denso
+};
+
+#endif // INDICE_ID_H
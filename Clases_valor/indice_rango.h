@@ -0,0 +1,206 @@
+#ifndef INDICE_RANGO_H
+#define INDICE_RANGO_H
+
+#include "paralelo.h"
+#include <algorithm> // std::merge, std::copy, std::lower_bound, std::upper_bound
+#include <cstddef>
+#include <cstdint>
+#include <cstring>   // std::memcpy
+#include <vector>
+
+/**
+ * Índice de rangos sobre una columna numérica: permutación de filas ordenada por valor.
+ *
+ * POR QUÉ: "Todos con patrimonio entre X y Y", cuántos hay o qué valor marca el
+ *          percentil 90 exigían un recorrido completo (o un ordenamiento) por consulta.
+ * CÓMO: 'filas' lista las filas de menor a mayor valor (en un empate, la de menor índice
+ *       primero), así que las filas de un rango son un tramo contiguo. Para ubicar el
+ *       tramo sin saltar por toda la columna, 'separadores' guarda el valor de cada
+ *       64.ª posición (1.25 MB con 10M filas, como el nivel interno de un árbol B+
+ *       estático): una búsqueda binaria sobre él da el bloque y otra de seis pasos dentro
+ *       del bloque da la posición exacta. La columna no se copia; las consultas reciben
+ *       su puntero.
+ *       construir() ordena un tramo por hilo (radix sobre la representación entera del
+ *       double, sin comparaciones) y luego mezcla los tramos de dos en dos, también en
+ *       paralelo.
+ * PARA QUÉ: Contar un rango en O(log n), listarlo en O(log n + k) en orden de valor y
+ *           leer cualquier percentil en O(1), con 4 bytes por fila.
+ *
+ * Las filas se guardan en 32 bits, como en IndiceCiudadGrupo; con más de 2^32 - 1
+ * filas el índice queda sin construir.
+ */
+class IndiceRango {
+public:
+    static const size_t FILAS_POR_SEPARADOR = 64;
+
+    // Posiciones [inicio, fin) de la permutación y sus filas
+    struct Rango {
+        const uint32_t* inicio;
+        const uint32_t* fin;
+
+        const uint32_t* begin() const { return inicio; }
+        const uint32_t* end() const { return fin; }
+        size_t size() const { return static_cast<size_t>(fin - inicio); }
+        bool empty() const { return inicio == fin; }
+    };
+
+    IndiceRango() {}
+
+    /**
+     * @param valores Columna a indexar (n valores, sin NaN).
+     * @param hilos Hilos a usar (0 = todos los núcleos).
+     */
+    void construir(const double* valores, size_t n, unsigned hilos = 0) {
+        *this = IndiceRango();
+        if (n > UINT32_MAX) return;
+
+        // Pares (clave, fila): el ordenamiento lee memoria contigua en vez de saltar a la columna
+        std::vector<Par> pares(n), auxiliar(n);
+        hilos = hilosEfectivos(hilos);
+        const size_t maximoHilos = std::max<size_t>(1, n / FILAS_MINIMAS_POR_HILO);
+        if (hilos > maximoHilos) hilos = static_cast<unsigned>(maximoHilos);
+        const size_t tamTramo = (n + hilos - 1) / hilos;
+        std::vector<size_t> limites; // Inicio de cada tramo ordenado, más n al final
+        for (size_t inicio = 0; inicio < n; inicio += tamTramo) limites.push_back(inicio);
+        limites.push_back(n);
+
+        ejecutarEnBloques(limites.size() - 1, hilos, [&](size_t primero, size_t ultimo, unsigned) {
+            for (size_t t = primero; t < ultimo; ++t) {
+                for (size_t i = limites[t]; i < limites[t + 1]; ++i) {
+                    pares[i] = Par{claveOrdenable(valores[i]), static_cast<uint32_t>(i)};
+                }
+                ordenarPorRadix(pares.data() + limites[t], auxiliar.data() + limites[t], limites[t + 1] - limites[t]);
+            }
+        });
+
+        // Mezcla de tramos vecinos, de dos en dos, hasta que queda uno
+        while (limites.size() > 2) {
+            const size_t numTramos = limites.size() - 1;
+            std::vector<size_t> siguientes;
+            for (size_t t = 0; t < numTramos; t += 2) siguientes.push_back(limites[t]);
+            siguientes.push_back(n);
+            ejecutarEnBloques((numTramos + 1) / 2, hilos, [&](size_t primero, size_t ultimo, unsigned) {
+                for (size_t m = primero; m < ultimo; ++m) {
+                    const size_t a = limites[2 * m], b = limites[std::min(2 * m + 1, numTramos)],
+                                 c = limites[std::min(2 * m + 2, numTramos)];
+                    std::merge(pares.begin() + a, pares.begin() + b, pares.begin() + b, pares.begin() + c,
+                               auxiliar.begin() + a, menor);
+                }
+            });
+            pares.swap(auxiliar);
+            limites.swap(siguientes);
+        }
+
+        filas_.resize(n);
+        separadores_.resize((n + FILAS_POR_SEPARADOR - 1) / FILAS_POR_SEPARADOR);
+        ejecutarEnBloques(n, hilos, [&](size_t inicio, size_t fin, unsigned) {
+            for (size_t i = inicio; i < fin; ++i) {
+                filas_[i] = pares[i].fila;
+                if (i % FILAS_POR_SEPARADOR == 0) separadores_[i / FILAS_POR_SEPARADOR] = valores[pares[i].fila];
+            }
+        });
+    }
+
+    // true si el índice describe exactamente 'n' filas (si no, hay que recorrer la columna)
+    bool vigentePara(size_t n) const { return !filas_.empty() && filas_.size() == n; }
+
+    size_t size() const { return filas_.size(); }
+
+    // Filas con valor en [minimo, maximo], de menor a mayor valor
+    Rango filas(const double* valores, double minimo, double maximo) const {
+        const size_t inicio = primeraPosicion(valores, minimo, false);
+        const size_t fin = minimo <= maximo ? primeraPosicion(valores, maximo, true) : inicio;
+        return Rango{filas_.data() + inicio, filas_.data() + std::max(inicio, fin)};
+    }
+
+    // Número de filas con valor en [minimo, maximo], sin leerlas
+    size_t contar(const double* valores, double minimo, double maximo) const {
+        return filas(valores, minimo, maximo).size();
+    }
+
+    // Fila en la posición dada del orden ascendente (0 = menor valor)
+    size_t filaEnPosicion(size_t posicion) const { return filas_[posicion]; }
+
+private:
+    struct Par {
+        uint64_t clave; // claveOrdenable(valor)
+        uint32_t fila;
+    };
+
+    static bool menor(const Par& a, const Par& b) {
+        return a.clave < b.clave || (a.clave == b.clave && a.fila < b.fila);
+    }
+
+    // Entero sin signo con el mismo orden que el double: en los positivos se enciende el bit de
+    // signo y en los negativos se invierten todos los bits (-0.0 se toma como 0.0)
+    static uint64_t claveOrdenable(double valor) {
+        if (valor == 0.0) valor = 0.0;
+        uint64_t bits;
+        std::memcpy(&bits, &valor, sizeof bits);
+        const uint64_t signo = uint64_t(1) << 63;
+        return (bits & signo) ? ~bits : bits | signo;
+    }
+
+    /**
+     * Ordena n pares por clave con radix LSD de 11 bits; 'auxiliar' es un búfer de n pares.
+     *
+     * CÓMO: Un recorrido cuenta los seis dígitos a la vez y luego cada pasada reparte los
+     *       pares por un dígito, del menos al más significativo (2048 cubetas: los destinos
+     *       activos caben en la caché). Las pasadas cuyo dígito es igual en todas las claves
+     *       (p. ej. los bits altos del exponente) se saltan. Cada pasada es estable, así que
+     *       con la misma clave queda primero la fila menor.
+     */
+    static void ordenarPorRadix(Par* pares, Par* auxiliar, size_t n) {
+        const unsigned BITS = 11, DIGITOS = 6, CUBETAS = 1u << BITS;
+        if (n == 0) return;
+        std::vector<size_t> conteos(DIGITOS * CUBETAS, 0);
+        for (size_t i = 0; i < n; ++i) {
+            for (unsigned d = 0; d < DIGITOS; ++d) ++conteos[d * CUBETAS + ((pares[i].clave >> (BITS * d)) & (CUBETAS - 1))];
+        }
+        Par* origen = pares;
+        Par* destino = auxiliar;
+        for (unsigned d = 0; d < DIGITOS; ++d) {
+            size_t* conteo = conteos.data() + d * CUBETAS;
+            const unsigned desplazamiento = BITS * d;
+            if (conteo[(origen[0].clave >> desplazamiento) & (CUBETAS - 1)] == n) continue; // Todas con el mismo dígito
+            size_t posicion = 0;
+            for (unsigned b = 0; b < CUBETAS; ++b) {
+                const size_t cantidad = conteo[b];
+                conteo[b] = posicion;
+                posicion += cantidad;
+            }
+            for (size_t i = 0; i < n; ++i) destino[conteo[(origen[i].clave >> desplazamiento) & (CUBETAS - 1)]++] = origen[i];
+            std::swap(origen, destino);
+        }
+        if (origen != pares) std::copy(origen, origen + n, pares);
+    }
+
+    /**
+     * Primera posición cuyo valor es >= 'valor' (o > 'valor' si 'estricto').
+     *
+     * CÓMO: Búsqueda binaria en los separadores para el bloque de 64 posiciones y
+     *       luego dentro del bloque leyendo la columna a través de la permutación.
+     */
+    size_t primeraPosicion(const double* valores, double valor, bool estricto) const {
+        // Primer separador que ya cumple: la posición buscada está en el bloque que termina en él
+        const std::vector<double>::const_iterator separador =
+            estricto ? std::upper_bound(separadores_.begin(), separadores_.end(), valor)
+                     : std::lower_bound(separadores_.begin(), separadores_.end(), valor);
+        const size_t bloque = static_cast<size_t>(separador - separadores_.begin());
+        if (bloque == 0) return 0;
+
+        const size_t inicio = (bloque - 1) * FILAS_POR_SEPARADOR;
+        const size_t fin = std::min(filas_.size(), bloque * FILAS_POR_SEPARADOR);
+        const uint32_t* primera = filas_.data() + inicio;
+        const uint32_t* ultima = filas_.data() + fin;
+        const uint32_t* posicion =
+            estricto ? std::upper_bound(primera, ultima, valor, [valores](double v, uint32_t f) { return v < valores[f]; })
+                     : std::lower_bound(primera, ultima, valor, [valores](uint32_t f, double v) { return valores[f] < v; });
+        return static_cast<size_t>(posicion - filas_.data());
+    }
+
+    std::vector<uint32_t> filas_;      // Filas ordenadas por (valor, fila)
+    std::vector<double> separadores_;  // Valor de las posiciones 0, 64, 128... de filas_
+};
+
+#endif // INDICE_RANGO_H
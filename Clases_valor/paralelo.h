@@ -0,0 +1,91 @@
+#ifndef PARALELO_H
+#define PARALELO_H
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/**
+ * Número de hilos a usar cuando el usuario pide "todos los núcleos" (0).
+ *
+ * POR QUÉ: hardware_concurrency() puede devolver 0 si no se conoce el valor.
+ * CÓMO: Se respeta la petición explícita y, si es 0, se consulta al sistema.
+ * PARA QUÉ: Tener siempre al menos un hilo de trabajo.
+ */
+inline unsigned hilosEfectivos(unsigned pedidos) {
+    if (pedidos > 0) return pedidos;
+    unsigned disponibles = std::thread::hardware_concurrency();
+    return disponibles > 0 ? disponibles : 1;
+}
+
+/**
+ * Reparte el rango [0, n) en bloques contiguos y ejecuta fn(inicio, fin, bloque)
+ * para cada uno en su propio hilo.
+ *
+ * POR QUÉ: Las operaciones masivas (generación, recorridos) son independientes por fila.
+ * CÓMO: Divide n en 'hilos' bloques de tamaño casi igual; el bloque 0 corre en el
+ *       hilo llamador y los demás en std::thread, que se esperan con join().
+ * PARA QUÉ: Aprovechar todos los núcleos sin depender de una biblioteca externa.
+ */
+template <typename Funcion>
+void ejecutarEnBloques(size_t n, unsigned hilos, Funcion fn) {
+    hilos = hilosEfectivos(hilos);
+    if (n == 0) return;
+    if (hilos > n) hilos = static_cast<unsigned>(n);
+
+    const size_t tamBloque = (n + hilos - 1) / hilos;
+    std::vector<std::thread> trabajadores;
+    trabajadores.reserve(hilos - 1);
+
+    for (unsigned b = 1; b < hilos; ++b) {
+        size_t inicio = b * tamBloque;
+        size_t fin = std::min(n, inicio + tamBloque);
+        if (inicio >= fin) break;
+        trabajadores.emplace_back(fn, inicio, fin, b);
+    }
+    fn(size_t(0), std::min(n, tamBloque), 0u);
+
+    for (auto& t : trabajadores) t.join();
+}
+
+// Filas mínimas por hilo en una reducción; con menos, crear el hilo cuesta más que recorrerlas
+const size_t FILAS_MINIMAS_POR_HILO = size_t(1) << 15;
+
+/**
+ * Reducción paralela determinista sobre el rango [0, n).
+ *
+ * POR QUÉ: Las búsquedas de máximos, mínimos y conteos recorren millones de filas en
+ *          un solo núcleo, pero cada bloque de filas se puede reducir por separado.
+ * CÓMO: Cada bloque de ejecutarEnBloques parte de una copia de 'inicial' y la actualiza
+ *       con reducir(inicio, fin, parcial) en una variable local del hilo (sin compartir
+ *       líneas de caché); al terminar, los parciales se combinan en el hilo llamador
+ *       con combinar(acumulado, parcial) en orden de bloque. Si 'combinar' solo reemplaza
+ *       con un valor estrictamente mejor, en un empate gana la fila de menor índice,
+ *       igual que el recorrido secuencial. Se usan como máximo n / FILAS_MINIMAS_POR_HILO
+ *       hilos, así que las colecciones pequeñas se reducen en el hilo llamador.
+ * PARA QUÉ: Reducciones que escalan con el número de núcleos y devuelven exactamente
+ *           el mismo resultado que la versión secuencial.
+ *
+ * @param hilos Hilos pedidos (0 = todos los núcleos).
+ */
+template <typename Parcial, typename Reducir, typename Combinar>
+Parcial reducirEnParalelo(size_t n, unsigned hilos, const Parcial& inicial, Reducir reducir, Combinar combinar) {
+    hilos = hilosEfectivos(hilos);
+    const size_t maximoHilos = std::max<size_t>(1, n / FILAS_MINIMAS_POR_HILO);
+    if (hilos > maximoHilos) hilos = static_cast<unsigned>(maximoHilos);
+
+    std::vector<Parcial> parciales(hilos, inicial);
+    ejecutarEnBloques(n, hilos, [&](size_t inicio, size_t fin, unsigned bloque) {
+        Parcial local = inicial;
+        reducir(inicio, fin, local);
+        parciales[bloque] = std::move(local);
+    });
+
+    Parcial resultado = std::move(parciales[0]);
+    for (unsigned b = 1; b < hilos; ++b) combinar(resultado, parciales[b]);
+    return resultado;
+}
+
+#endif // PARALELO_H
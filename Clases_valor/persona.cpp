@@ -1,16 +1,19 @@
 #include "persona.h"
+#include "salida.h"
 #include <iomanip> // Para std::setprecision
 
 /**
  * Implementación del constructor de Persona.
  * 
  * POR QUÉ: Inicializar los miembros de la clase.
- * CÓMO: Usando la lista de inicialización y moviendo los strings para evitar copias.
+ * CÓMO: Usando la lista de inicialización; nombre, apellido y ciudad se internan
+ *       en sus diccionarios y solo se guarda el código; la fecha "D/M/AAAA" se
+ *       convierte a AAAAMMDD.
  * PARA QUÉ: Eficiencia y correcta construcción del objeto.
  */
 Persona::Persona(std::string nom,
                  std::string ape,
-                 std::string id,
+                 uint64_t id,
                  std::string ciudad,
                  std::string fecha,
                  double ingresos,
@@ -18,6 +21,34 @@ Persona::Persona(std::string nom,
                  double deud,
                  bool declara,
                  char grupoDeclaracion)
+    : nombre(diccionarioNombres().codificar(nom)),
+      apellido(diccionarioApellidos().codificar(ape)),
+      id(id),
+      ciudadNacimiento(diccionarioCiudades().codificar(ciudad)),
+      fechaNacimiento(fechaAAAAMMDD(fecha)),
+      ingresosAnuales(ingresos),
+      patrimonio(patri),
+      deudas(deud),
+      declaranteRenta(declara),
+      grupoDeclaracion(grupoDeclaracion) {}
+
+/**
+ * Implementación del constructor por códigos.
+ * 
+ * POR QUÉ: Evitar buscar en los diccionarios textos cuyo código ya se conoce.
+ * CÓMO: Copia los códigos directamente en la lista de inicialización.
+ * PARA QUÉ: Generación rápida y sin bloqueos.
+ */
+Persona::Persona(CodigoCadena nom,
+                 CodigoCadena ape,
+                 uint64_t id,
+                 CodigoCadena ciudad,
+                 FechaAAAAMMDD fecha,
+                 double ingresos,
+                 double patri,
+                 double deud,
+                 bool declara,
+                 char grupoDeclaracion)
     : nombre(nom),
       apellido(ape),
       id(id),
@@ -38,9 +69,9 @@ Persona::Persona(std::string nom,
  */
 void Persona::mostrar() const {
     std::cout << "-------------------------------------\n";
-    std::cout << "[" << id << "] Nombre: " << nombre << " " << apellido << "\n";
-    std::cout << "   - Ciudad de nacimiento: " << ciudadNacimiento << "\n";
-    std::cout << "   - Fecha de nacimiento: " << fechaNacimiento << "\n\n";
+    std::cout << "[" << id << "] Nombre: " << diccionarioNombres().texto(nombre) << " " << diccionarioApellidos().texto(apellido) << "\n";
+    std::cout << "   - Ciudad de nacimiento: " << diccionarioCiudades().texto(ciudadNacimiento) << "\n";
+    std::cout << "   - Fecha de nacimiento: " << formatearFecha(fechaNacimiento) << "\n\n";
     std::cout << std::fixed << std::setprecision(2); // Formato de números
     std::cout << "   - Ingresos anuales: $" << ingresosAnuales << "\n";
     std::cout << "   - Patrimonio: $" << patrimonio << "\n";
@@ -57,8 +88,23 @@ void Persona::mostrar() const {
  * PARA QUÉ: Listados rápidos y eficientes.
  */
 void Persona::mostrarResumen() const {
-    std::cout << "[" << id << "] " << nombre << " " << apellido
-              << " | " << ciudadNacimiento 
+    std::cout << "[" << id << "] " << diccionarioNombres().texto(nombre) << " " << diccionarioApellidos().texto(apellido)
+              << " | " << diccionarioCiudades().texto(ciudadNacimiento) 
               << " | $" << std::fixed << std::setprecision(2) << ingresosAnuales
               << " | Grupo" <<grupoDeclaracion;
 }
+
+void Persona::formatearResumen(BufferTexto& salida) const {
+    salida.agregar('[');
+    salida.agregarEntero(id);
+    salida.agregar("] ");
+    salida.agregar(diccionarioNombres().texto(nombre));
+    salida.agregar(' ');
+    salida.agregar(diccionarioApellidos().texto(apellido));
+    salida.agregar(" | ");
+    salida.agregar(diccionarioCiudades().texto(ciudadNacimiento));
+    salida.agregar(" | $");
+    salida.agregarDecimal2(ingresosAnuales);
+    salida.agregar(" | Grupo");
+    salida.agregar(grupoDeclaracion);
+}
@@ -0,0 +1,76 @@
+#include "generador.h"
+#include "monitor.h"
+#include "motor.h"
+#include <cerrno>   // errno, ERANGE
+#include <climits>  // INT_MAX
+#include <cstdlib>  // std::strtol
+#include <iostream>
+#include <string>
+
+/**
+ * Compara en un solo binario las quince combinaciones almacenamiento x paso.
+ *
+ * POR QUÉ: Clases_* y Estructuras_* son cuatro programas independientes; comparar sus
+ *          tiempos exigía correr cada uno por separado con la misma semilla y juntar los
+ *          resultados a mano, y no incluían el almacén columnar.
+ * CÓMO: Genera las personas una vez (generador paralelo con semilla fija), las pasa a
+ *       columnas y corre la carga de motor.h sobre {clase, struct, compacta, dividida,
+ *       columnas} x {valor, referencia, puntero}. Cada consulta se mide con las
+ *       repeticiones del Monitor y se comprueba contra la primera variante.
+ * PARA QUÉ: Una tabla cabeza a cabeza con datos idénticos y el mismo método de medición.
+ *
+ * Uso: programa [personas] [repeticiones] [calentamiento] [archivo.csv]
+ * Personas en [1, INT_MAX]; repeticiones y calentamiento en [0, INT_MAX].
+ * Devuelve 1 si alguna variante dio un resultado distinto, 2 por error de uso.
+ */
+int main(int argc, char* argv[]) {
+    long parametros[3] = {1000000, 5, 1}; // Personas, repeticiones, calentamiento
+    for (int i = 1; i < argc && i <= 3; ++i) {
+        char* fin = nullptr;
+        errno = 0;
+        parametros[i - 1] = std::strtol(argv[i], &fin, 10);
+        // Se rechaza lo que no sea un número completo, lo que desborda long y lo que no cabe en int
+        if (fin == argv[i] || *fin != '\0' || errno == ERANGE || parametros[i - 1] < (i == 1 ? 1 : 0) ||
+            parametros[i - 1] > INT_MAX) {
+            std::cerr << "Uso: " << argv[0] << " [personas] [repeticiones] [calentamiento] [archivo.csv]\n";
+            return 2;
+        }
+    }
+    const std::string archivoCsv = argc > 4 ? argv[4] : "";
+
+    Monitor monitor;
+    monitor.iniciar_tiempo();
+    PersonaColumns datos = construirColumnas(generarColeccionParalela(static_cast<int>(parametros[0]), 42, 0));
+    std::cout << "Generadas " << datos.size() << " personas en " << monitor.detener_tiempo() << " ms\n";
+    monitor.configurar_repeticiones(static_cast<int>(parametros[1]), static_cast<int>(parametros[2]));
+
+    TablaComparativa tabla;
+    ResultadosReferencia referencia;
+    compararVariante<AlmacenColumnas, PasoReferencia>(datos, monitor, tabla, referencia);
+    compararVariante<AlmacenColumnas, PasoPuntero>(datos, monitor, tabla, referencia);
+    compararVariante<AlmacenColumnas, PasoValor>(datos, monitor, tabla, referencia);
+    compararVariante<AlmacenStruct, PasoReferencia>(datos, monitor, tabla, referencia);
+    compararVariante<AlmacenStruct, PasoPuntero>(datos, monitor, tabla, referencia);
+    compararVariante<AlmacenStruct, PasoValor>(datos, monitor, tabla, referencia);
+    compararVariante<AlmacenClase, PasoReferencia>(datos, monitor, tabla, referencia);
+    compararVariante<AlmacenClase, PasoPuntero>(datos, monitor, tabla, referencia);
+    compararVariante<AlmacenClase, PasoValor>(datos, monitor, tabla, referencia);
+    compararVariante<AlmacenCompacta, PasoReferencia>(datos, monitor, tabla, referencia);
+    compararVariante<AlmacenCompacta, PasoPuntero>(datos, monitor, tabla, referencia);
+    compararVariante<AlmacenCompacta, PasoValor>(datos, monitor, tabla, referencia);
+    compararVariante<AlmacenDividida, PasoReferencia>(datos, monitor, tabla, referencia);
+    compararVariante<AlmacenDividida, PasoPuntero>(datos, monitor, tabla, referencia);
+    compararVariante<AlmacenDividida, PasoValor>(datos, monitor, tabla, referencia);
+
+    std::cout << "\n=== COMPARATIVA (" << datos.size() << " personas, mediana de "
+              << (monitor.repeticiones() > 0 ? monitor.repeticiones() : 1) << " repeticiones) ===\n";
+    tabla.mostrar(std::cout);
+    const bool exportado = archivoCsv.empty() || monitor.exportar_csv(archivoCsv);
+
+    if (!tabla.todasCorrectas()) {
+        std::cout << "\n[ERROR] Las celdas marcadas con '!' no coinciden con columnas/referencia\n";
+        return 1;
+    }
+    std::cout << "\nTodas las variantes dieron los mismos resultados\n";
+    return exportado ? 0 : 1; // Un CSV perdido no debe pasar por corrida correcta
+}
@@ -0,0 +1,456 @@
+#ifndef MOTOR_H
+#define MOTOR_H
+
+#include "columnas.h"
+#include "diccionario.h"
+#include "fecha.h"
+#include "monitor.h"
+#include "persona_compacta.h"
+#include "persona_dividida.h"
+#include <algorithm> // std::max
+#include <cmath>     // std::fabs
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/**
+ * Motor de consultas genérico sobre las variantes de almacenamiento de personas.
+ *
+ * POR QUÉ: Las cuatro carpetas repiten generador, monitor y main casi línea por línea y
+ *          solo cambian clase/struct y valor/apuntador; para compararlas había que
+ *          compilar y correr cuatro programas a mano con los mismos datos.
+ * CÓMO: Cada consulta se escribe una sola vez como plantilla sobre una política de
+ *       almacenamiento (cómo se guardan las personas y cómo se lee un campo de la fila i)
+ *       y una política de paso (cómo recibe la consulta la colección). Los datos se
+ *       generan una vez en columnas y se convierten a cada almacenamiento.
+ * PARA QUÉ: Un solo binario que corre la misma carga sobre todas las combinaciones y las
+ *           compara en una tabla (ver main.cpp).
+ */
+
+// ===================== Políticas de almacenamiento =====================
+
+// Persona como clase con campos privados y getters (mismos campos y orden que Clases_*/persona.h)
+class PersonaClase {
+public:
+    PersonaClase(const PersonaColumns& c, size_t i)
+        : nombre(c.nombre[i]), apellido(c.apellido[i]), id(c.id[i]), ciudadNacimiento(c.ciudad[i]),
+          fechaNacimiento(c.fechaNacimiento[i]), ingresosAnuales(c.ingresosAnuales[i]),
+          patrimonio(c.patrimonio[i]), deudas(c.deudas[i]), declaranteRenta(c.declaranteRenta[i] != 0),
+          grupoDeclaracion(c.grupoDeclaracion[i]) {}
+
+    uint64_t getId() const { return id; }
+    CodigoCadena getCodigoCiudad() const { return ciudadNacimiento; }
+    FechaAAAAMMDD getFechaNacimiento() const { return fechaNacimiento; }
+    double getPatrimonio() const { return patrimonio; }
+    double getDeudas() const { return deudas; }
+    char getGrupoDeclaracion() const { return grupoDeclaracion; }
+
+private:
+    CodigoCadena nombre;
+    CodigoCadena apellido;
+    uint64_t id;
+    CodigoCadena ciudadNacimiento;
+    FechaAAAAMMDD fechaNacimiento;
+    double ingresosAnuales;
+    double patrimonio;
+    double deudas;
+    bool declaranteRenta;
+    char grupoDeclaracion;
+};
+
+// Persona como struct de campos públicos (mismos campos y orden que Estructuras_*/persona.h)
+struct PersonaStruct {
+    CodigoCadena nombre;
+    CodigoCadena apellido;
+    uint64_t id;
+    CodigoCadena ciudadNacimiento;
+    FechaAAAAMMDD fechaNacimiento;
+    double ingresosAnuales;
+    double patrimonio;
+    double deudas;
+    bool declaranteRenta;
+    char grupoDeclaracion;
+};
+
+// Vector de PersonaClase; los campos se leen con getters
+struct AlmacenClase {
+    typedef std::vector<PersonaClase> Coleccion;
+    static const char* nombre() { return "clase"; }
+
+    static Coleccion construir(const PersonaColumns& c) {
+        Coleccion personas;
+        personas.reserve(c.size());
+        for (size_t i = 0; i < c.size(); ++i) personas.emplace_back(c, i);
+        return personas;
+    }
+    static size_t bytes(const Coleccion& p) { return p.size() * sizeof(PersonaClase); }
+
+    static size_t filas(const Coleccion& p) { return p.size(); }
+    static uint64_t id(const Coleccion& p, size_t i) { return p[i].getId(); }
+    static size_t ciudad(const Coleccion& p, size_t i) { return p[i].getCodigoCiudad(); }
+    static FechaAAAAMMDD fecha(const Coleccion& p, size_t i) { return p[i].getFechaNacimiento(); }
+    static double patrimonio(const Coleccion& p, size_t i) { return p[i].getPatrimonio(); }
+    static double deudas(const Coleccion& p, size_t i) { return p[i].getDeudas(); }
+    static char grupo(const Coleccion& p, size_t i) { return p[i].getGrupoDeclaracion(); }
+};
+
+// Vector de PersonaStruct; los campos se leen directamente
+struct AlmacenStruct {
+    typedef std::vector<PersonaStruct> Coleccion;
+    static const char* nombre() { return "struct"; }
+
+    static Coleccion construir(const PersonaColumns& c) {
+        Coleccion personas(c.size());
+        for (size_t i = 0; i < c.size(); ++i) {
+            personas[i] = PersonaStruct{c.nombre[i], c.apellido[i], c.id[i], c.ciudad[i], c.fechaNacimiento[i],
+                                        c.ingresosAnuales[i], c.patrimonio[i], c.deudas[i],
+                                        c.declaranteRenta[i] != 0, c.grupoDeclaracion[i]};
+        }
+        return personas;
+    }
+    static size_t bytes(const Coleccion& p) { return p.size() * sizeof(PersonaStruct); }
+
+    static size_t filas(const Coleccion& p) { return p.size(); }
+    static uint64_t id(const Coleccion& p, size_t i) { return p[i].id; }
+    static size_t ciudad(const Coleccion& p, size_t i) { return p[i].ciudadNacimiento; }
+    static FechaAAAAMMDD fecha(const Coleccion& p, size_t i) { return p[i].fechaNacimiento; }
+    static double patrimonio(const Coleccion& p, size_t i) { return p[i].patrimonio; }
+    static double deudas(const Coleccion& p, size_t i) { return p[i].deudas; }
+    static char grupo(const Coleccion& p, size_t i) { return p[i].grupoDeclaracion; }
+};
+
+// PersonaColumns (struct-of-arrays); cada campo es un arreglo contiguo
+struct AlmacenColumnas {
+    typedef PersonaColumns Coleccion;
+    static const char* nombre() { return "columnas"; }
+
+    static Coleccion construir(const PersonaColumns& c) { return c; }
+    static size_t bytes(const Coleccion& c) {
+        return c.size() * (sizeof(uint64_t) + 2 * sizeof(CodigoCadena) + sizeof(FechaAAAAMMDD) + sizeof(uint8_t) +
+                           3 * sizeof(double) + sizeof(uint8_t) + sizeof(char));
+    }
+
+    static size_t filas(const Coleccion& c) { return c.size(); }
+    static uint64_t id(const Coleccion& c, size_t i) { return c.id[i]; }
+    static size_t ciudad(const Coleccion& c, size_t i) { return c.ciudad[i]; }
+    static FechaAAAAMMDD fecha(const Coleccion& c, size_t i) { return c.fechaNacimiento[i]; }
+    static double patrimonio(const Coleccion& c, size_t i) { return c.patrimonio[i]; }
+    static double deudas(const Coleccion& c, size_t i) { return c.deudas[i]; }
+    static char grupo(const Coleccion& c, size_t i) { return c.grupoDeclaracion[i]; }
+};
+
+// PersonaCompacta: registros de 64 bytes alineados a línea de caché, montos en centavos
+struct AlmacenCompacta {
+    typedef ColeccionCompacta Coleccion;
+    static const char* nombre() { return "compacta"; }
+
+    // Un hilo, como la construcción de las demás políticas
+    static Coleccion construir(const PersonaColumns& c) { return construirCompactas(c, 1); }
+    static size_t bytes(const Coleccion& p) { return p.size() * sizeof(PersonaCompacta); }
+
+    static size_t filas(const Coleccion& p) { return p.size(); }
+    static uint64_t id(const Coleccion& p, size_t i) { return p[i].id; }
+    static size_t ciudad(const Coleccion& p, size_t i) { return p[i].ciudad; }
+    static FechaAAAAMMDD fecha(const Coleccion& p, size_t i) { return p[i].fechaNacimiento; }
+    static double patrimonio(const Coleccion& p, size_t i) { return p[i].patrimonio(); }
+    static double deudas(const Coleccion& p, size_t i) { return p[i].deudas(); }
+    static char grupo(const Coleccion& p, size_t i) { return p[i].grupoDeclaracion(); }
+};
+
+// PersonasDivididas: tabla caliente de 24 bytes por fila y tabla fría (ID, ingresos, nombres) aparte
+struct AlmacenDividida {
+    typedef PersonasDivididas Coleccion;
+    static const char* nombre() { return "dividida"; }
+
+    // Un hilo, como la construcción de las demás políticas
+    static Coleccion construir(const PersonaColumns& c) { return construirDivididas(c, 1); }
+    static size_t bytes(const Coleccion& p) { return p.size() * (sizeof(PersonaCaliente) + sizeof(PersonaFria)); }
+
+    static size_t filas(const Coleccion& p) { return p.size(); }
+    static uint64_t id(const Coleccion& p, size_t i) { return p.frias[i].id; }
+    static size_t ciudad(const Coleccion& p, size_t i) { return p.calientes[i].ciudad; }
+    static FechaAAAAMMDD fecha(const Coleccion& p, size_t i) { return p.calientes[i].fechaNacimiento; }
+    static double patrimonio(const Coleccion& p, size_t i) { return p.calientes[i].patrimonio; }
+    static double deudas(const Coleccion& p, size_t i) { return p.calientes[i].deudas; }
+    static char grupo(const Coleccion& p, size_t i) { return p.calientes[i].grupoDeclaracion; }
+};
+
+// ===================== Políticas de paso =====================
+// Cada una entrega la colección a la consulta como lo hacen las variantes originales.
+
+// Por valor: la consulta recibe su propia copia (como std::vector<Persona> personas en *_valor)
+struct PasoValor {
+    static const char* nombre() { return "valor"; }
+    template <typename Coleccion, typename Consulta>
+    static auto entregar(const Coleccion& coleccion, Consulta consulta) { return recibir<Coleccion>(coleccion, consulta); }
+
+private:
+    template <typename Coleccion, typename Consulta>
+    static auto recibir(Coleccion copia, Consulta consulta) { return consulta(copia); }
+};
+
+// Por referencia constante: sin copia
+struct PasoReferencia {
+    static const char* nombre() { return "referencia"; }
+    template <typename Coleccion, typename Consulta>
+    static auto entregar(const Coleccion& coleccion, Consulta consulta) { return consulta(coleccion); }
+};
+
+// Por puntero: como const std::vector<Persona>* en *_apuntadores
+struct PasoPuntero {
+    static const char* nombre() { return "puntero"; }
+    template <typename Coleccion, typename Consulta>
+    static auto entregar(const Coleccion& coleccion, Consulta consulta) { return recibir(&coleccion, consulta); }
+
+private:
+    template <typename Coleccion, typename Consulta>
+    static auto recibir(const Coleccion* personas, Consulta consulta) { return consulta(*personas); }
+};
+
+// ===================== Consultas genéricas =====================
+// Una sola implementación por consulta, sin hilos ni SIMD, para que las diferencias entre
+// variantes vengan solo del almacenamiento y del paso. Todas devuelven su resultado para
+// comprobar que las variantes coinciden.
+
+// Primera fila con el mayor patrimonio
+template <typename Almacen>
+size_t filaMayorPatrimonio(const typename Almacen::Coleccion& c) {
+    size_t mejor = FILA_INVALIDA;
+    for (size_t i = 0; i < Almacen::filas(c); ++i) {
+        if (mejor == FILA_INVALIDA || Almacen::patrimonio(c, i) > Almacen::patrimonio(c, mejor)) mejor = i;
+    }
+    return mejor;
+}
+
+// Primera fila con la mayor deuda
+template <typename Almacen>
+size_t filaMayorDeuda(const typename Almacen::Coleccion& c) {
+    size_t mejor = FILA_INVALIDA;
+    for (size_t i = 0; i < Almacen::filas(c); ++i) {
+        if (mejor == FILA_INVALIDA || Almacen::deudas(c, i) > Almacen::deudas(c, mejor)) mejor = i;
+    }
+    return mejor;
+}
+
+// Primera fila con la fecha de nacimiento más antigua
+template <typename Almacen>
+size_t filaMasLongeva(const typename Almacen::Coleccion& c) {
+    size_t mejor = FILA_INVALIDA;
+    for (size_t i = 0; i < Almacen::filas(c); ++i) {
+        if (mejor == FILA_INVALIDA || Almacen::fecha(c, i) < Almacen::fecha(c, mejor)) mejor = i;
+    }
+    return mejor;
+}
+
+// Fila con el mayor patrimonio de cada ciudad (FILA_INVALIDA si la ciudad no tiene personas)
+template <typename Almacen>
+std::vector<size_t> filasMayorPatrimonioPorCiudad(const typename Almacen::Coleccion& c) {
+    std::vector<size_t> mejores(diccionarioCiudades().size(), FILA_INVALIDA);
+    for (size_t i = 0; i < Almacen::filas(c); ++i) {
+        size_t& mejor = mejores[Almacen::ciudad(c, i)];
+        if (mejor == FILA_INVALIDA || Almacen::patrimonio(c, i) > Almacen::patrimonio(c, mejor)) mejor = i;
+    }
+    return mejores;
+}
+
+// Letra del grupo (A, B o C) con más personas en cada ciudad; empate a favor de la primera
+template <typename Almacen>
+std::vector<char> grupoMayorPorCiudad(const typename Almacen::Coleccion& c) {
+    const size_t numCiudades = diccionarioCiudades().size();
+    std::vector<size_t> conteos(numCiudades * NUM_GRUPOS, 0);
+    for (size_t i = 0; i < Almacen::filas(c); ++i) {
+        conteos[Almacen::ciudad(c, i) * NUM_GRUPOS + indiceGrupoConN(Almacen::grupo(c, i))]++;
+    }
+    std::vector<char> mayores(numCiudades);
+    for (size_t ciudad = 0; ciudad < numCiudades; ++ciudad) {
+        const size_t* grupos = &conteos[ciudad * NUM_GRUPOS];
+        const size_t mayor = std::max({grupos[0], grupos[1], grupos[2]});
+        mayores[ciudad] = mayor == grupos[0] ? 'A' : (mayor == grupos[1] ? 'B' : 'C');
+    }
+    return mayores;
+}
+
+// Patrimonio promedio de cada ciudad (0 si no tiene personas); suma en orden de fila
+template <typename Almacen>
+std::vector<double> promedioPatrimonioPorCiudad(const typename Almacen::Coleccion& c) {
+    const size_t numCiudades = diccionarioCiudades().size();
+    std::vector<double> sumas(numCiudades, 0.0);
+    std::vector<size_t> conteos(numCiudades, 0);
+    for (size_t i = 0; i < Almacen::filas(c); ++i) {
+        sumas[Almacen::ciudad(c, i)] += Almacen::patrimonio(c, i);
+        conteos[Almacen::ciudad(c, i)]++;
+    }
+    for (size_t ciudad = 0; ciudad < numCiudades; ++ciudad) {
+        if (conteos[ciudad] > 0) sumas[ciudad] /= static_cast<double>(conteos[ciudad]);
+    }
+    return sumas;
+}
+
+// Personas de un grupo de declaración
+template <typename Almacen>
+size_t contarGrupo(const typename Almacen::Coleccion& c, char grupo) {
+    size_t conteo = 0;
+    for (size_t i = 0; i < Almacen::filas(c); ++i) conteo += Almacen::grupo(c, i) == grupo;
+    return conteo;
+}
+
+// ===================== Comparación =====================
+
+/**
+ * Tabla de tiempos consulta x variante.
+ *
+ * Cada celda es la mediana de las repeticiones de Monitor::medir_repeticiones; una celda
+ * marcada con '!' dio un resultado distinto al de la primera variante.
+ */
+class TablaComparativa {
+public:
+    // Agrega (o reutiliza) una columna de variante y devuelve su posición
+    size_t variante(const std::string& nombre) {
+        for (size_t v = 0; v < variantes.size(); ++v) {
+            if (variantes[v] == nombre) return v;
+        }
+        variantes.push_back(nombre);
+        for (Fila& fila : filas) fila.celdas.resize(variantes.size());
+        return variantes.size() - 1;
+    }
+
+    void registrar(const std::string& consulta, size_t variante, double valor, bool correcto) {
+        Fila* fila = nullptr;
+        for (Fila& f : filas) {
+            if (f.consulta == consulta) fila = &f;
+        }
+        if (!fila) {
+            filas.push_back(Fila{consulta, std::vector<Celda>(variantes.size())});
+            fila = &filas.back();
+        }
+        fila->celdas[variante] = Celda{valor, correcto, true};
+    }
+
+    bool todasCorrectas() const {
+        for (const Fila& fila : filas) {
+            for (const Celda& celda : fila.celdas) {
+                if (celda.presente && !celda.correcto) return false;
+            }
+        }
+        return true;
+    }
+
+    void mostrar(std::ostream& salida) const {
+        const size_t anchoConsulta = 34;
+        const int anchoCelda = 20;
+        salida << std::left << std::setw(anchoConsulta) << "Consulta";
+        for (const std::string& v : variantes) salida << std::right << std::setw(anchoCelda) << v;
+        salida << "\n" << std::string(anchoConsulta + anchoCelda * variantes.size(), '-') << "\n";
+        for (const Fila& fila : filas) {
+            // setw cuenta bytes; se rellena a mano para que los acentos (UTF-8) no desalineen
+            size_t caracteres = 0;
+            for (unsigned char c : fila.consulta) caracteres += (c & 0xC0) != 0x80;
+            salida << fila.consulta << std::string(caracteres < anchoConsulta ? anchoConsulta - caracteres : 0, ' ');
+            for (const Celda& celda : fila.celdas) {
+                std::ostringstream texto;
+                if (celda.presente) texto << std::fixed << std::setprecision(3) << celda.valor << (celda.correcto ? "" : "!");
+                else texto << "-";
+                salida << std::right << std::setw(anchoCelda) << texto.str();
+            }
+            salida << "\n";
+        }
+    }
+
+private:
+    struct Celda {
+        double valor = 0;
+        bool correcto = true;
+        bool presente = false;
+    };
+    struct Fila {
+        std::string consulta;
+        std::vector<Celda> celdas;
+    };
+
+    std::vector<std::string> variantes;
+    std::vector<Fila> filas;
+};
+
+// Resultados iguales; los promedios admiten un centavo de diferencia porque AlmacenCompacta
+// suma montos redondeados al centavo
+template <typename T>
+bool coinciden(const T& a, const T& b) { return a == b; }
+
+inline bool coinciden(const std::vector<double>& a, const std::vector<double>& b) {
+    if (a.size() != b.size()) return false;
+    for (size_t i = 0; i < a.size(); ++i) {
+        if (std::fabs(a[i] - b[i]) > 0.01) return false;
+    }
+    return true;
+}
+
+// Resultados de la primera variante, con los que se comparan las demás
+struct ResultadosReferencia {
+    bool listos = false;
+    size_t mayorPatrimonio, mayorDeuda, masLongeva, grupoA;
+    std::vector<size_t> mayorPatrimonioPorCiudad;
+    std::vector<char> grupoPorCiudad;
+    std::vector<double> promedioPorCiudad;
+};
+
+/**
+ * Corre la carga completa sobre una combinación almacenamiento x paso.
+ *
+ * POR QUÉ: Comparar las variantes con los mismos datos, en el mismo proceso y con la
+ *          misma forma de medir.
+ * CÓMO: Convierte las columnas al almacenamiento (fila "Construir"), registra los MB que
+ *       ocupa y mide cada consulta con monitor.medir_repeticiones() entregando la
+ *       colección con la política de paso. El resultado de la última repetición se compara
+ *       con el de la primera variante ejecutada.
+ * PARA QUÉ: Llenar una columna de la TablaComparativa.
+ */
+template <typename Almacen, typename Paso>
+void compararVariante(const PersonaColumns& datos, Monitor& monitor, TablaComparativa& tabla,
+                      ResultadosReferencia& referencia) {
+    const std::string nombreVariante = std::string(Almacen::nombre()) + "/" + Paso::nombre();
+    const size_t v = tabla.variante(nombreVariante);
+    typedef typename Almacen::Coleccion Coleccion;
+
+    monitor.iniciar_tiempo();
+    Coleccion coleccion = Almacen::construir(datos);
+    tabla.registrar("Construir (ms)", v, monitor.detener_tiempo(), true);
+    tabla.registrar("Memoria (MB)", v, Almacen::bytes(coleccion) / (1024.0 * 1024.0), true);
+
+    // Mide 'consulta' y compara su resultado con el de referencia (o lo fija si es la primera variante)
+    auto medir = [&](const std::string& nombre, auto consulta, auto& esperado) {
+        decltype(consulta()) resultado{};
+        const double mediana = monitor.medir_repeticiones(nombre + " [" + nombreVariante + "]",
+                                                          [&]{ resultado = consulta(); });
+        if (!referencia.listos) esperado = resultado;
+        tabla.registrar(nombre + " (ms)", v, mediana, coinciden(resultado, esperado));
+    };
+
+    medir("Mayor patrimonio", [&]{
+        return Paso::entregar(coleccion, [](const Coleccion& c) { return filaMayorPatrimonio<Almacen>(c); });
+    }, referencia.mayorPatrimonio);
+    medir("Mayor deuda", [&]{
+        return Paso::entregar(coleccion, [](const Coleccion& c) { return filaMayorDeuda<Almacen>(c); });
+    }, referencia.mayorDeuda);
+    medir("Más longeva", [&]{
+        return Paso::entregar(coleccion, [](const Coleccion& c) { return filaMasLongeva<Almacen>(c); });
+    }, referencia.masLongeva);
+    medir("Mayor patrimonio por ciudad", [&]{
+        return Paso::entregar(coleccion, [](const Coleccion& c) { return filasMayorPatrimonioPorCiudad<Almacen>(c); });
+    }, referencia.mayorPatrimonioPorCiudad);
+    medir("Grupo mayor por ciudad", [&]{
+        return Paso::entregar(coleccion, [](const Coleccion& c) { return grupoMayorPorCiudad<Almacen>(c); });
+    }, referencia.grupoPorCiudad);
+    medir("Promedio por ciudad", [&]{
+        return Paso::entregar(coleccion, [](const Coleccion& c) { return promedioPatrimonioPorCiudad<Almacen>(c); });
+    }, referencia.promedioPorCiudad);
+    medir("Contar grupo A", [&]{
+        return Paso::entregar(coleccion, [](const Coleccion& c) { return contarGrupo<Almacen>(c, 'A'); });
+    }, referencia.grupoA);
+    referencia.listos = true;
+}
+
+#endif // MOTOR_H
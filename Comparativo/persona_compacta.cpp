@@ -0,0 +1,23 @@
+#include "persona_compacta.h"
+#include "paralelo.h"
+#include <algorithm> // std::max
+
+PersonaCompacta compactarFila(const PersonaColumns& columnas, size_t fila) {
+    return PersonaCompacta::crear(columnas.id[fila], columnas.nombre[fila], columnas.apellido[fila],
+                                  columnas.ciudad[fila], columnas.fechaNacimiento[fila],
+                                  columnas.ingresosAnuales[fila], columnas.patrimonio[fila], columnas.deudas[fila],
+                                  columnas.declaranteRenta[fila] != 0, columnas.grupoDeclaracion[fila]);
+}
+
+ColeccionCompacta construirCompactas(const PersonaColumns& columnas, unsigned hilos) {
+    const size_t n = columnas.size();
+    ColeccionCompacta compactas(n);
+
+    hilos = hilosEfectivos(hilos);
+    const size_t maximoHilos = std::max<size_t>(1, n / FILAS_MINIMAS_POR_HILO);
+    if (hilos > maximoHilos) hilos = static_cast<unsigned>(maximoHilos);
+    ejecutarEnBloques(n, hilos, [&](size_t inicio, size_t fin, unsigned) {
+        for (size_t i = inicio; i < fin; ++i) compactas[i] = compactarFila(columnas, i);
+    });
+    return compactas;
+}
@@ -0,0 +1,92 @@
+#ifndef PERSONA_COMPACTA_H
+#define PERSONA_COMPACTA_H
+
+#include "arena.h"
+#include "columnas.h"
+#include "diccionario.h"
+#include "fecha.h"
+#include <cmath>   // std::llround
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * Registro de persona de tamaño fijo: exactamente una línea de caché de 64 bytes.
+ *
+ * POR QUÉ: sizeof(Persona) no es múltiplo de 64, así que en un vector muchos registros
+ *          quedan partidos entre dos líneas de caché y un recorrido por filas trae dos
+ *          líneas por persona. Los montos en double tampoco se pueden sumar sin errores
+ *          de redondeo que dependen del orden.
+ * CÓMO: Campos de ancho fijo ordenados de mayor a menor (sin relleno interno): ID
+ *       numérico, montos en centavos (int64), códigos de diccionario, fecha AAAAMMDD y un
+ *       byte de banderas con el índice de grupo (2 bits) y el bit de declarante.
+ *       alignas(64) completa el registro a 64 bytes y alinea cada uno al inicio de una
+ *       línea; la arena (ver arena.h) respeta esa alineación en la colección.
+ * PARA QUÉ: Un recorrido por filas que trae una sola línea por persona y 10M personas
+ *           en 640 MB, con montos exactos al centavo.
+ *
+ * La conversión desde las columnas redondea cada monto al centavo más cercano; los
+ * accesores devuelven los montos como centavos / 100.
+ */
+struct alignas(64) PersonaCompacta {
+    uint64_t id;                    // Identificador numérico (cédula)
+    int64_t ingresosCentavos;       // Ingresos anuales en centavos
+    int64_t patrimonioCentavos;     // Patrimonio total en centavos
+    int64_t deudasCentavos;         // Deudas totales en centavos
+    CodigoCadena nombre;            // Código en diccionarioNombres()
+    CodigoCadena apellido;          // Código en diccionarioApellidos()
+    CodigoCadena ciudad;            // Código en diccionarioCiudades()
+    FechaAAAAMMDD fechaNacimiento;  // Fecha en formato AAAAMMDD
+    uint8_t banderas;               // Bits 0-1: indiceGrupoConN; bit 2: declarante
+
+    static const uint8_t MASCARA_GRUPO = 0x3;
+    static const uint8_t BIT_DECLARANTE = 0x4;
+
+    // Arma el registro; los montos se redondean al centavo y un grupo distinto de A, B o C se guarda como N
+    static PersonaCompacta crear(uint64_t id, CodigoCadena nombre, CodigoCadena apellido, CodigoCadena ciudad,
+                                 FechaAAAAMMDD fecha, double ingresos, double patrimonio, double deudas,
+                                 bool declarante, char grupo) {
+        PersonaCompacta p{};
+        p.id = id;
+        p.ingresosCentavos = aCentavos(ingresos);
+        p.patrimonioCentavos = aCentavos(patrimonio);
+        p.deudasCentavos = aCentavos(deudas);
+        p.nombre = nombre;
+        p.apellido = apellido;
+        p.ciudad = ciudad;
+        p.fechaNacimiento = fecha;
+        p.banderas = static_cast<uint8_t>(indiceGrupoConN(grupo)) | (declarante ? BIT_DECLARANTE : 0);
+        return p;
+    }
+
+    static int64_t aCentavos(double pesos) { return static_cast<int64_t>(std::llround(pesos * 100.0)); }
+    static double aPesos(int64_t centavos) { return static_cast<double>(centavos) / 100.0; }
+
+    double ingresosAnuales() const { return aPesos(ingresosCentavos); }
+    double patrimonio() const { return aPesos(patrimonioCentavos); }
+    double deudas() const { return aPesos(deudasCentavos); }
+    size_t indiceGrupo() const { return banderas & MASCARA_GRUPO; }
+    char grupoDeclaracion() const { return LETRAS_GRUPO[indiceGrupo()]; }
+    bool declaranteRenta() const { return (banderas & BIT_DECLARANTE) != 0; }
+};
+
+static_assert(sizeof(PersonaCompacta) == 64, "PersonaCompacta debe ocupar una línea de caché");
+static_assert(alignof(PersonaCompacta) == 64, "PersonaCompacta debe alinearse a una línea de caché");
+
+// Colección de registros compactos; la arena alinea el bloque a 64 bytes (std::allocator no lo garantiza en C++14)
+typedef std::vector<PersonaCompacta, AsignadorArena<PersonaCompacta>> ColeccionCompacta;
+
+// Registro compacto de la fila 'fila' del almacén columnar
+PersonaCompacta compactarFila(const PersonaColumns& columnas, size_t fila);
+
+/**
+ * Convierte el almacén columnar a registros compactos.
+ *
+ * CÓMO: Reserva la colección completa y reparte las filas entre los hilos (cada hilo
+ *       escribe su bloque de registros, sin compartir líneas de caché).
+ *
+ * @param hilos Hilos a usar (0 = todos los núcleos).
+ */
+ColeccionCompacta construirCompactas(const PersonaColumns& columnas, unsigned hilos = 0);
+
+#endif // PERSONA_COMPACTA_H
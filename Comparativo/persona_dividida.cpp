@@ -0,0 +1,21 @@
+#include "persona_dividida.h"
+#include "paralelo.h"
+#include <algorithm> // std::max
+
+PersonasDivididas construirDivididas(const PersonaColumns& columnas, unsigned hilos) {
+    const size_t n = columnas.size();
+    PersonasDivididas divididas;
+    divididas.redimensionar(n);
+
+    hilos = hilosEfectivos(hilos);
+    const size_t maximoHilos = std::max<size_t>(1, n / FILAS_MINIMAS_POR_HILO);
+    if (hilos > maximoHilos) hilos = static_cast<unsigned>(maximoHilos);
+    ejecutarEnBloques(n, hilos, [&](size_t inicio, size_t fin, unsigned) {
+        for (size_t i = inicio; i < fin; ++i) {
+            divididas.escribir(i, columnas.id[i], columnas.nombre[i], columnas.apellido[i], columnas.ciudad[i],
+                               columnas.fechaNacimiento[i], columnas.ingresosAnuales[i], columnas.patrimonio[i],
+                               columnas.deudas[i], columnas.declaranteRenta[i] != 0, columnas.grupoDeclaracion[i]);
+        }
+    });
+    return divididas;
+}
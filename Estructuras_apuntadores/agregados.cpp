@@ -0,0 +1,444 @@
+#include "agregados.h"
+#include "paralelo.h" // reducirEnParalelo
+#include "salida.h"   // escribirRegistros, hilosSalida
+#include "top_k.h"
+#include <algorithm> // std::sort, std::nth_element, std::max
+#include <cmath>     // std::ceil
+#include <iomanip>   // std::setprecision
+#include <iostream>
+#include <string>
+
+size_t numeroDeClaves(AgrupacionAgregado agrupacion) {
+    switch (agrupacion) {
+        case AgrupacionAgregado::Total:        return 1;
+        case AgrupacionAgregado::Ciudad:       return diccionarioCiudades().size();
+        case AgrupacionAgregado::Grupo:        return NUM_GRUPOS;
+        case AgrupacionAgregado::CiudadYGrupo: return diccionarioCiudades().size() * NUM_GRUPOS;
+    }
+    return 1;
+}
+
+namespace {
+    // Estado de una solicitud durante el recorrido
+    struct Acumulador {
+        OperacionAgregado operacion;
+        int clave;                          // Posición en el arreglo de claves de la fila
+        const double* reales;               // Columna double, o nullptr
+        const FechaAAAAMMDD* fechas;        // Columna de fechas, o nullptr
+        ResultadoAgregado* resultado;
+    };
+
+    // Columna double de un campo (nullptr para la fecha)
+    const double* columnaReal(const PersonaColumns& c, CampoAgregado campo) {
+        switch (campo) {
+            case CampoAgregado::Ingresos:   return c.ingresosAnuales.data();
+            case CampoAgregado::Patrimonio: return c.patrimonio.data();
+            case CampoAgregado::Deudas:     return c.deudas.data();
+            default:                        return nullptr;
+        }
+    }
+}
+
+std::vector<ResultadoAgregado> calcularAgregados(const PersonaColumns& columnas,
+                                                 const std::vector<SolicitudAgregado>& solicitudes) {
+    std::vector<ResultadoAgregado> resultados(solicitudes.size());
+    std::vector<Acumulador> acumuladores(solicitudes.size());
+
+    for (size_t s = 0; s < solicitudes.size(); ++s) {
+        const SolicitudAgregado& solicitud = solicitudes[s];
+        const size_t claves = numeroDeClaves(solicitud.agrupacion);
+        ResultadoAgregado& r = resultados[s];
+        r.solicitud = solicitud;
+        r.valor.assign(claves, 0.0);
+        r.fila.assign(claves, FILA_INVALIDA);
+        r.conteo.assign(claves, 0);
+
+        Acumulador& a = acumuladores[s];
+        a.operacion = solicitud.operacion;
+        a.clave = static_cast<int>(solicitud.agrupacion);
+        a.reales = columnaReal(columnas, solicitud.campo);
+        a.fechas = a.reales ? nullptr : columnas.fechaNacimiento.data();
+        a.resultado = &r;
+    }
+
+    for (size_t i = 0; i < columnas.size(); ++i) {
+        const size_t ciudad = columnas.ciudad[i];
+        const size_t grupo = static_cast<size_t>(indiceGrupoConN(columnas.grupoDeclaracion[i]));
+        // En el mismo orden que AgrupacionAgregado
+        const size_t claves[4] = {0, ciudad, grupo, ciudad * NUM_GRUPOS + grupo};
+
+        for (Acumulador& a : acumuladores) {
+            ResultadoAgregado& r = *a.resultado;
+            const size_t k = claves[a.clave];
+            r.conteo[k]++;
+            if (a.operacion == OperacionAgregado::Conteo) continue;
+
+            const double v = a.reales ? a.reales[i] : static_cast<double>(a.fechas[i]);
+            switch (a.operacion) {
+                case OperacionAgregado::Maximo:
+                    if (r.fila[k] == FILA_INVALIDA || v > r.valor[k]) { r.valor[k] = v; r.fila[k] = i; }
+                    break;
+                case OperacionAgregado::Minimo:
+                    if (r.fila[k] == FILA_INVALIDA || v < r.valor[k]) { r.valor[k] = v; r.fila[k] = i; }
+                    break;
+                default: // Suma y Promedio
+                    r.valor[k] += v;
+                    break;
+            }
+        }
+    }
+
+    for (ResultadoAgregado& r : resultados) {
+        for (size_t k = 0; k < r.valor.size(); ++k) {
+            if (r.solicitud.operacion == OperacionAgregado::Conteo) {
+                r.valor[k] = static_cast<double>(r.conteo[k]);
+            } else if (r.solicitud.operacion == OperacionAgregado::Promedio && r.conteo[k] > 0) {
+                r.valor[k] /= r.conteo[k];
+            }
+        }
+    }
+    return resultados;
+}
+
+namespace {
+    // Nombre y apellido de la fila, como en las consultas individuales
+    std::string nombreCompleto(const PersonaColumns& c, size_t fila) {
+        return diccionarioNombres().texto(c.nombre[fila]) + " " + diccionarioApellidos().texto(c.apellido[fila]);
+    }
+
+    // Lista "- etiqueta: nombre apellido (valor)" de un máximo por ciudad o por grupo
+    void mostrarMaximos(const PersonaColumns& c, const char* titulo, const ResultadoAgregado& r) {
+        std::cout << std::fixed << std::setprecision(2);
+        std::cout << "\n=== " << titulo << " ===\n";
+        for (size_t k = 0; k < r.fila.size(); ++k) {
+            if (r.fila[k] == FILA_INVALIDA) continue;
+            std::cout << "- ";
+            if (r.solicitud.agrupacion == AgrupacionAgregado::Grupo) std::cout << LETRAS_GRUPO[k];
+            else std::cout << diccionarioCiudades().texto(k);
+            std::cout << ": " << nombreCompleto(c, r.fila[k]) << " (" << r.valor[k] << ")\n";
+        }
+    }
+}
+
+void mostrarReporteCompleto(const PersonaColumns& columnas) {
+    typedef OperacionAgregado Op;
+    typedef CampoAgregado Campo;
+    typedef AgrupacionAgregado Por;
+
+    // En el orden del menú principal
+    const std::vector<SolicitudAgregado> solicitudes = {
+        {Op::Minimo,   Campo::FechaNacimiento, Por::Total},         // 0: opción 5
+        {Op::Minimo,   Campo::FechaNacimiento, Por::Ciudad},        // 1: opción 5
+        {Op::Maximo,   Campo::Patrimonio,      Por::Total},         // 2: opción 6
+        {Op::Maximo,   Campo::Patrimonio,      Por::Ciudad},        // 3: opción 6
+        {Op::Maximo,   Campo::Patrimonio,      Por::Grupo},         // 4: opción 6
+        {Op::Conteo,   Campo::Patrimonio,      Por::CiudadYGrupo},  // 5: opciones 7 y 8
+        {Op::Promedio, Campo::Patrimonio,      Por::Ciudad},        // 6: opción 9
+        {Op::Maximo,   Campo::Deudas,          Por::Total},         // 7: opción 10
+        {Op::Maximo,   Campo::Deudas,          Por::Ciudad},        // 8: opción 10
+        {Op::Maximo,   Campo::Deudas,          Por::Grupo},         // 9: opción 10
+    };
+    const std::vector<ResultadoAgregado> r = calcularAgregados(columnas, solicitudes);
+
+    std::cout << "\n=== Persona más longeva en Colombia ===\n";
+    mostrarFila(columnas, r[0].fila[0]);
+    std::cout << "\n=== Persona más longeva por ciudad ===\n";
+    for (size_t c = 0; c < r[1].fila.size(); ++c) {
+        const size_t f = r[1].fila[c];
+        if (f == FILA_INVALIDA) continue;
+        std::cout << "- " << diccionarioCiudades().texto(c) << ": " << nombreCompleto(columnas, f)
+                  << " (" << formatearFecha(columnas.fechaNacimiento[f]) << ")\n";
+    }
+
+    std::cout << "\n=== Persona con mayor patrimonio en Colombia ===\n";
+    mostrarFila(columnas, r[2].fila[0]);
+    mostrarMaximos(columnas, "Personas con mayor patrimonio por ciudad", r[3]);
+    mostrarMaximos(columnas, "Personas con mayor patrimonio por grupo de declaración", r[4]);
+
+    std::cout << "\n=== Personas por grupo de declaración ===\n";
+    uint64_t totalGrupos[NUM_GRUPOS] = {0, 0, 0, 0};
+    for (size_t k = 0; k < r[5].conteo.size(); ++k) totalGrupos[k % NUM_GRUPOS] += r[5].conteo[k];
+    for (size_t g = 0; g < NUM_GRUPOS; ++g) {
+        std::cout << "- " << LETRAS_GRUPO[g] << ": " << totalGrupos[g] << " personas\n";
+    }
+
+    std::cout << "\n";
+    for (size_t c = 0; c < diccionarioCiudades().size(); ++c) {
+        const uint64_t* grupos = &r[5].conteo[c * NUM_GRUPOS];
+        // Solo A, B y C compiten, como en calcularGrupoMayorPorCiudad
+        uint64_t mayorGrupo = std::max({grupos[0], grupos[1], grupos[2]});
+        char mayorGrupoLetra = (mayorGrupo == grupos[0])   ? 'A'
+                               : (mayorGrupo == grupos[1]) ? 'B'
+                                                           : 'C';
+        std::cout << "El grupo con más personas en la ciudad " << diccionarioCiudades().texto(c)
+                  << " es el grupo " << mayorGrupoLetra << " con " << mayorGrupo
+                  << " personas." << std::endl;
+    }
+
+    std::vector<std::pair<double, size_t>> promediosConId;
+    for (size_t c = 0; c < r[6].valor.size(); ++c) {
+        if (r[6].conteo[c] > 0) promediosConId.push_back({r[6].valor[c], c});
+    }
+    std::sort(promediosConId.begin(), promediosConId.end(),
+              [](const std::pair<double, size_t>& a, const std::pair<double, size_t>& b) {
+                  return a.first > b.first;
+              });
+
+    std::cout << "\nPromedio de patrimonio por ciudad:\n";
+    std::cout << std::fixed << std::setprecision(2) << std::showpoint;
+    for (size_t i = 0; i < 3 && i < promediosConId.size(); ++i) {
+        std::cout << diccionarioCiudades().texto(promediosConId[i].second) << ": "
+                  << promediosConId[i].first << std::endl;
+    }
+
+    std::cout << "\n=== Persona con mayor deuda en Colombia ===\n";
+    mostrarFila(columnas, r[7].fila[0]);
+    mostrarMaximos(columnas, "Personas con mayor deuda por ciudad", r[8]);
+    mostrarMaximos(columnas, "Personas con mayor deuda por grupo de declaración", r[9]);
+}
+
+namespace {
+    typedef std::vector<MonticuloTopK> Monticulos;
+
+    // Un MonticuloTopK por clave con las K mejores filas según valorDeFila; un recorrido repartido entre hilos
+    template <typename Valor, typename Clave>
+    Monticulos mejoresKPorClave(size_t n, size_t numClaves, size_t k, unsigned hilos, Valor valorDeFila,
+                                Clave claveDeFila) {
+        return reducirEnParalelo(n, hilos, Monticulos(numClaves, MonticuloTopK(k)),
+            [&](size_t inicio, size_t fin, Monticulos& parcial) {
+                for (size_t i = inicio; i < fin; ++i) parcial[claveDeFila(i)].agregar(valorDeFila(i), i);
+            },
+            [&](Monticulos& acumulado, const Monticulos& parcial) {
+                for (size_t c = 0; c < numClaves; ++c) acumulado[c].combinar(parcial[c]);
+            });
+    }
+}
+
+ResultadoTopK calcularTopK(const PersonaColumns& columnas, CampoAgregado campo, AgrupacionAgregado agrupacion,
+                           size_t k, unsigned hilos) {
+    const size_t n = columnas.size();
+    const size_t numClaves = numeroDeClaves(agrupacion);
+    const double* reales = columnaReal(columnas, campo);
+    const FechaAAAAMMDD* fechas = columnas.fechaNacimiento.data();
+    const uint8_t* ciudades = columnas.ciudad.data();
+    const char* grupos = columnas.grupoDeclaracion.data();
+    k = std::min(k, n);
+
+    // Campo y agrupación se resuelven fuera del recorrido: una instancia del bucle por combinación
+    auto porAgrupacion = [&](auto valorDeFila) {
+        switch (agrupacion) {
+            case AgrupacionAgregado::Total:
+                return mejoresKPorClave(n, numClaves, k, hilos, valorDeFila, [](size_t) { return size_t(0); });
+            case AgrupacionAgregado::Ciudad:
+                return mejoresKPorClave(n, numClaves, k, hilos, valorDeFila,
+                                        [ciudades](size_t i) { return static_cast<size_t>(ciudades[i]); });
+            case AgrupacionAgregado::Grupo:
+                return mejoresKPorClave(n, numClaves, k, hilos, valorDeFila,
+                                        [grupos](size_t i) { return static_cast<size_t>(indiceGrupoConN(grupos[i])); });
+            default:
+                return mejoresKPorClave(n, numClaves, k, hilos, valorDeFila, [ciudades, grupos](size_t i) {
+                    return ciudades[i] * NUM_GRUPOS + static_cast<size_t>(indiceGrupoConN(grupos[i]));
+                });
+        }
+    };
+    // La fecha se niega para que la más antigua sea la de mayor valor
+    const Monticulos mejores = reales ? porAgrupacion([reales](size_t i) { return reales[i]; })
+                                      : porAgrupacion([fechas](size_t i) { return -static_cast<double>(fechas[i]); });
+
+    ResultadoTopK resultado{campo, agrupacion, std::vector<std::vector<size_t>>(numClaves)};
+    for (size_t c = 0; c < numClaves; ++c) {
+        for (const MonticuloTopK::Entrada& e : mejores[c].ordenadas()) resultado.filas[c].push_back(e.fila);
+    }
+    return resultado;
+}
+
+void mostrarTopK(const PersonaColumns& columnas, const ResultadoTopK& resultado) {
+    static const char* const NOMBRES_CAMPO[] = {"ingresos", "patrimonio", "deudas", "fecha de nacimiento"};
+    const double* reales = columnaReal(columnas, resultado.campo);
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "\n=== Top por " << NOMBRES_CAMPO[static_cast<int>(resultado.campo)] << " ===\n";
+    for (size_t c = 0; c < resultado.filas.size(); ++c) {
+        const std::vector<size_t>& filas = resultado.filas[c];
+        if (filas.empty()) continue;
+        switch (resultado.agrupacion) {
+            case AgrupacionAgregado::Total:  break;
+            case AgrupacionAgregado::Ciudad: std::cout << "\n--- " << diccionarioCiudades().texto(c) << " ---\n"; break;
+            case AgrupacionAgregado::Grupo:  std::cout << "\n--- Grupo " << LETRAS_GRUPO[c] << " ---\n"; break;
+            default:
+                std::cout << "\n--- " << diccionarioCiudades().texto(c / NUM_GRUPOS) << ", grupo "
+                          << LETRAS_GRUPO[c % NUM_GRUPOS] << " ---\n";
+        }
+        for (size_t p = 0; p < filas.size(); ++p) {
+            const size_t f = filas[p];
+            std::cout << p + 1 << ". [" << columnas.id[f] << "] " << nombreCompleto(columnas, f) << " (";
+            if (reales) std::cout << reales[f];
+            else std::cout << formatearFecha(columnas.fechaNacimiento[f]);
+            std::cout << ")\n";
+        }
+    }
+}
+
+namespace {
+    const char* const NOMBRES_CAMPO_RANGO[] = {"ingresos", "patrimonio", "deudas"};
+
+    // Índice de rango de un campo financiero (se construye en la primera consulta que lo pide); nullptr para
+    // la fecha o si el índice no describe las filas actuales (más de 2^32 - 1 filas)
+    const IndiceRango* indiceRangoVigente(const PersonaColumns& c, CampoAgregado campo) {
+        const IndiceRango* indice = nullptr;
+        switch (campo) {
+            case CampoAgregado::Ingresos:   indice = &c.rangoIngresos(); break;
+            case CampoAgregado::Patrimonio: indice = &c.rangoPatrimonio(); break;
+            case CampoAgregado::Deudas:     indice = &c.rangoDeudas(); break;
+            default:                        return nullptr;
+        }
+        return indice->vigentePara(c.size()) ? indice : nullptr;
+    }
+
+    // Orden del índice de rango: menor valor y, con el mismo valor, menor fila
+    struct MenorPorValor {
+        const double* valores;
+        bool operator()(size_t a, size_t b) const {
+            return valores[a] < valores[b] || (valores[a] == valores[b] && a < b);
+        }
+    };
+}
+
+size_t contarEnRango(const PersonaColumns& columnas, CampoAgregado campo, double minimo, double maximo) {
+    const double* valores = columnaReal(columnas, campo);
+    if (!valores) return 0;
+    if (const IndiceRango* indice = indiceRangoVigente(columnas, campo)) return indice->contar(valores, minimo, maximo);
+
+    return reducirEnParalelo(columnas.size(), 0, size_t(0),
+        [&](size_t inicio, size_t fin, size_t& parcial) {
+            for (size_t i = inicio; i < fin; ++i) parcial += valores[i] >= minimo && valores[i] <= maximo;
+        },
+        [](size_t& acumulado, size_t parcial) { acumulado += parcial; });
+}
+
+size_t listarEnRango(const PersonaColumns& columnas, CampoAgregado campo, double minimo, double maximo) {
+    const double* valores = columnaReal(columnas, campo);
+    if (!valores) return 0;
+
+    // Filas del rango de menor a mayor valor: un tramo del índice o, sin índice, las del recorrido ordenadas
+    const IndiceRango* indice = indiceRangoVigente(columnas, campo);
+    const IndiceRango::Rango tramo = indice ? indice->filas(valores, minimo, maximo) : IndiceRango::Rango{nullptr, nullptr};
+    std::vector<size_t> recorridas;
+    if (!indice) {
+        for (size_t i = 0; i < columnas.size(); ++i) {
+            if (valores[i] >= minimo && valores[i] <= maximo) recorridas.push_back(i);
+        }
+        std::sort(recorridas.begin(), recorridas.end(), MenorPorValor{valores});
+    }
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "Personas con " << NOMBRES_CAMPO_RANGO[static_cast<int>(campo)] << " entre " << minimo << " y "
+              << maximo << ":\n";
+    return escribirRegistros(indice ? tramo.size() : recorridas.size(), hilosSalida(), [&](size_t k, BufferTexto& salida) {
+        const size_t f = indice ? tramo.inicio[k] : recorridas[k];
+        salida.agregarEntero(columnas.id[f]);
+        salida.agregar(' ');
+        salida.agregar(nombreCompleto(columnas, f));
+        salida.agregar(' ');
+        salida.agregarDecimal2(valores[f]);
+        salida.agregar('\n');
+        return true;
+    });
+}
+
+size_t filaPercentil(const PersonaColumns& columnas, CampoAgregado campo, double percentil) {
+    const size_t n = columnas.size();
+    const double* valores = columnaReal(columnas, campo);
+    if (n == 0 || !valores) return FILA_INVALIDA;
+
+    // Rango más cercano: la posición ceil(p/100 x n) contando desde 1
+    const double rango = std::ceil(std::min(100.0, std::max(0.0, percentil)) / 100.0 * static_cast<double>(n));
+    const size_t posicion = rango < 1.0 ? 0 : std::min(n, static_cast<size_t>(rango)) - 1;
+    if (const IndiceRango* indice = indiceRangoVigente(columnas, campo)) return indice->filaEnPosicion(posicion);
+
+    // Sin índice: selección de la posición en O(n) sobre todas las filas
+    std::vector<size_t> filas(n);
+    for (size_t i = 0; i < n; ++i) filas[i] = i;
+    std::nth_element(filas.begin(), filas.begin() + posicion, filas.end(), MenorPorValor{valores});
+    return filas[posicion];
+}
+
+IndiceColumnar indiceRangoDeCampo(CampoAgregado campo) {
+    switch (campo) {
+        case CampoAgregado::Ingresos: return IndiceColumnar::RangoIngresos;
+        case CampoAgregado::Deudas:   return IndiceColumnar::RangoDeudas;
+        default:                      return IndiceColumnar::RangoPatrimonio;
+    }
+}
+
+size_t contarDeudaSobrePatrimonio(const PersonaColumns& columnas, double fraccion) {
+    const double* patrimonio = columnas.patrimonio.data();
+    const double* deudas = columnas.deudas.data();
+    return reducirEnParalelo(columnas.size(), 0, size_t(0),
+        [&](size_t inicio, size_t fin, size_t& parcial) {
+            for (size_t i = inicio; i < fin; ++i) parcial += deudas[i] > fraccion * patrimonio[i];
+        },
+        [](size_t& acumulado, size_t parcial) { acumulado += parcial; });
+}
+
+AgregadoEnFlujo::AgregadoEnFlujo()
+    : personas(0), sumaPatrimonio(diccionarioCiudades().size(), 0.0),
+      conteo(diccionarioCiudades().size() * NUM_GRUPOS, 0),
+      mayorPatrimonio(diccionarioCiudades().size(), Maximo{0.0, 0, 0, 0}) {}
+
+void AgregadoEnFlujo::combinar(const AgregadoEnFlujo& posterior) {
+    personas += posterior.personas;
+    for (size_t c = 0; c < sumaPatrimonio.size(); ++c) sumaPatrimonio[c] += posterior.sumaPatrimonio[c];
+    for (size_t k = 0; k < conteo.size(); ++k) conteo[k] += posterior.conteo[k];
+    for (size_t c = 0; c < mayorPatrimonio.size(); ++c) {
+        const Maximo& otro = posterior.mayorPatrimonio[c];
+        if (otro.id != 0 && (mayorPatrimonio[c].id == 0 || otro.patrimonio > mayorPatrimonio[c].patrimonio)) {
+            mayorPatrimonio[c] = otro;
+        }
+    }
+}
+
+void mostrarAgregadoEnFlujo(const AgregadoEnFlujo& agregado) {
+    const size_t numCiudades = diccionarioCiudades().size();
+    std::cout << "\n=== Estadísticas de " << agregado.personas << " personas (sin guardarlas) ===\n";
+
+    std::vector<std::pair<double, size_t>> promediosConId;
+    for (size_t c = 0; c < numCiudades; ++c) {
+        uint64_t personasCiudad = 0;
+        for (size_t g = 0; g < NUM_GRUPOS; ++g) personasCiudad += agregado.conteo[c * NUM_GRUPOS + g];
+        if (personasCiudad > 0) promediosConId.push_back({agregado.sumaPatrimonio[c] / personasCiudad, c});
+    }
+    std::sort(promediosConId.begin(), promediosConId.end(),
+              [](const std::pair<double, size_t>& a, const std::pair<double, size_t>& b) {
+                  return a.first > b.first;
+              });
+    std::cout << "Promedio de patrimonio por ciudad:\n";
+    std::cout << std::fixed << std::setprecision(2) << std::showpoint;
+    for (size_t i = 0; i < 3 && i < promediosConId.size(); ++i) {
+        std::cout << diccionarioCiudades().texto(promediosConId[i].second) << ": "
+                  << promediosConId[i].first << std::endl;
+    }
+
+    std::cout << "\n";
+    for (size_t c = 0; c < numCiudades; ++c) {
+        const uint64_t* grupos = &agregado.conteo[c * NUM_GRUPOS];
+        // Solo A, B y C compiten, como en calcularGrupoMayorPorCiudad
+        uint64_t mayorGrupo = std::max({grupos[0], grupos[1], grupos[2]});
+        char mayorGrupoLetra = (mayorGrupo == grupos[0])   ? 'A'
+                               : (mayorGrupo == grupos[1]) ? 'B'
+                                                           : 'C';
+        std::cout << "El grupo con más personas en la ciudad " << diccionarioCiudades().texto(c)
+                  << " es el grupo " << mayorGrupoLetra << " con " << mayorGrupo
+                  << " personas." << std::endl;
+    }
+
+    std::cout << "\n=== Personas con mayor patrimonio por ciudad ===\n";
+    for (size_t c = 0; c < numCiudades; ++c) {
+        const AgregadoEnFlujo::Maximo& mayor = agregado.mayorPatrimonio[c];
+        if (mayor.id == 0) continue;
+        std::cout << "- " << diccionarioCiudades().texto(c) << ": "
+                  << diccionarioNombres().texto(mayor.nombre) << " "
+                  << diccionarioApellidos().texto(mayor.apellido) << " ("
+                  << mayor.patrimonio << ")\n";
+    }
+}
@@ -0,0 +1,52 @@
+#ifndef ALEATORIO_H
+#define ALEATORIO_H
+
+#include <cstdint>
+
+/**
+ * Generador de números aleatorios basado en contador (counter-based RNG).
+ *
+ * POR QUÉ: rand() y el std::mt19937 estático de randomDouble() guardan estado global,
+ *          así que generar personas en varios hilos a la vez produce carreras de datos
+ *          y resultados que dependen del orden en que corren los hilos.
+ * CÓMO: Cada número es una función pura de (semilla, índice, contador): la clave se
+ *       obtiene mezclando semilla e índice con el finalizador de SplitMix64, y cada
+ *       llamada a siguiente() mezcla la clave con un contador interno.
+ * PARA QUÉ: Que la persona i dependa solo de (semilla, i); el conjunto generado es
+ *           idéntico bit a bit sin importar cuántos hilos se usen ni cómo se reparta.
+ */
+class GeneradorContador {
+public:
+    GeneradorContador(uint64_t semilla, uint64_t indice)
+        : clave(mezclar(semilla ^ mezclar(indice + 0x9E3779B97F4A7C15ULL))), contador(0) {}
+
+    // Siguiente valor de 64 bits del flujo (semilla, índice)
+    uint64_t siguiente() {
+        ++contador;
+        return mezclar(clave + contador * 0x9E3779B97F4A7C15ULL);
+    }
+
+    // Entero uniforme en [0, n) sin usar el operador módulo (multiplicación alta)
+    uint32_t enteroMenorQue(uint32_t n) {
+        return static_cast<uint32_t>(((siguiente() >> 32) * n) >> 32);
+    }
+
+    // Decimal uniforme en [min, max) con 53 bits de precisión
+    double uniforme(double min, double max) {
+        const double u = static_cast<double>(siguiente() >> 11) * (1.0 / 9007199254740992.0);
+        return min + (max - min) * u;
+    }
+
+private:
+    // Finalizador de SplitMix64: mezcla completa de los 64 bits
+    static uint64_t mezclar(uint64_t x) {
+        x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+        return x ^ (x >> 31);
+    }
+
+    uint64_t clave;    // Mezcla de (semilla, índice), fija para toda la persona
+    uint64_t contador; // Número de valores ya extraídos de este flujo
+};
+
+#endif // ALEATORIO_H
@@ -0,0 +1,507 @@
+#include "columnas.h"
+#include "paralelo.h"
+#include "salida.h"
+#include "vectorial.h"
+#include <algorithm> // std::sort, std::find, std::min
+#include <cctype>    // std::toupper
+#include <iomanip>   // std::setprecision
+#include <iostream>
+
+void PersonaColumns::reservar(size_t n) {
+    id.reserve(n);
+    nombre.reserve(n);
+    apellido.reserve(n);
+    fechaNacimiento.reserve(n);
+    ciudad.reserve(n);
+    ingresosAnuales.reserve(n);
+    patrimonio.reserve(n);
+    deudas.reserve(n);
+    declaranteRenta.reserve(n);
+    grupoDeclaracion.reserve(n);
+}
+
+void PersonaColumns::indexarIDs() {
+    indiceID.construir(id.size(), [this](size_t fila) { return id[fila]; });
+}
+
+const IndiceCiudadGrupo& PersonaColumns::indiceCiudadGrupo() const {
+    return indiceCiudadGrupo_.obtener([this](IndiceCiudadGrupo& indice) {
+        indice.construir(size(), diccionarioCiudades().size(), NUM_GRUPOS,
+                         [this](size_t fila) { return static_cast<size_t>(ciudad[fila]); },
+                         [this](size_t fila) { return static_cast<size_t>(indiceGrupoConN(grupoDeclaracion[fila])); });
+    });
+}
+
+const IndiceMapasBits& PersonaColumns::mapasBits() const {
+    return mapasBits_.obtener([this](IndiceMapasBits& mapas) {
+        mapas.construir(size(), diccionarioCiudades().size(), NUM_GRUPOS,
+                        [this](size_t fila) { return static_cast<size_t>(ciudad[fila]); },
+                        [this](size_t fila) { return static_cast<size_t>(indiceGrupoConN(grupoDeclaracion[fila])); },
+                        [this](size_t fila) { return declaranteRenta[fila] != 0; });
+    });
+}
+
+const IndiceRango& PersonaColumns::rangoIngresos() const {
+    return rangoIngresos_.obtener([this](IndiceRango& indice) { indice.construir(ingresosAnuales.data(), size()); });
+}
+
+const IndiceRango& PersonaColumns::rangoPatrimonio() const {
+    return rangoPatrimonio_.obtener([this](IndiceRango& indice) { indice.construir(patrimonio.data(), size()); });
+}
+
+const IndiceRango& PersonaColumns::rangoDeudas() const {
+    return rangoDeudas_.obtener([this](IndiceRango& indice) { indice.construir(deudas.data(), size()); });
+}
+
+const char* const NOMBRES_INDICE_COLUMNAR[] = {
+    "índice ciudad-grupo", "mapas de bits", "índice de rango de ingresos", "índice de rango de patrimonio",
+    "índice de rango de deudas"
+};
+
+bool PersonaColumns::indiceListo(IndiceColumnar indice) const {
+    switch (indice) {
+        case IndiceColumnar::CiudadGrupo:     return indiceCiudadGrupo_.listo();
+        case IndiceColumnar::MapasBits:       return mapasBits_.listo();
+        case IndiceColumnar::RangoIngresos:   return rangoIngresos_.listo();
+        case IndiceColumnar::RangoPatrimonio: return rangoPatrimonio_.listo();
+        case IndiceColumnar::RangoDeudas:     return rangoDeudas_.listo();
+    }
+    return false;
+}
+
+void PersonaColumns::construirIndice(IndiceColumnar indice) const {
+    switch (indice) {
+        case IndiceColumnar::CiudadGrupo:     indiceCiudadGrupo(); break;
+        case IndiceColumnar::MapasBits:       mapasBits(); break;
+        case IndiceColumnar::RangoIngresos:   rangoIngresos(); break;
+        case IndiceColumnar::RangoPatrimonio: rangoPatrimonio(); break;
+        case IndiceColumnar::RangoDeudas:     rangoDeudas(); break;
+    }
+}
+
+const char LETRAS_GRUPO[NUM_GRUPOS] = {'A', 'B', 'C', 'N'};
+
+namespace {
+    // Índice 0-2 para los grupos A, B y C; -1 para cualquier otro
+    int indiceGrupo(char grupo) {
+        switch (grupo) {
+            case 'A': return 0;
+            case 'B': return 1;
+            case 'C': return 2;
+            default:  return -1;
+        }
+    }
+
+    /**
+     * Mejor fila de cada clave según 'esMejor', repartiendo las filas entre los núcleos.
+     *
+     * POR QUÉ: Los máximos y mínimos por ciudad y por grupo son la misma reducción con
+     *          distinta clave y distinto criterio.
+     * CÓMO: Cada hilo guarda la mejor fila de cada clave en su bloque; los parciales se
+     *       combinan en orden de bloque con el mismo criterio estricto, así que en un
+     *       empate se conserva la fila de menor índice.
+     * PARA QUÉ: El mismo resultado que el recorrido secuencial en una fracción del tiempo.
+     *
+     * @param claveDeFila Función fila -> clave en [0, numClaves).
+     * @param esMejor Función (fila, filaActual) -> true si 'fila' es estrictamente mejor.
+     */
+    template <typename Clave, typename EsMejor>
+    std::vector<size_t> mejoresPorClave(size_t n, size_t numClaves, Clave claveDeFila, EsMejor esMejor) {
+        return reducirEnParalelo(n, 0, std::vector<size_t>(numClaves, FILA_INVALIDA),
+            [&](size_t inicio, size_t fin, std::vector<size_t>& mejores) {
+                for (size_t i = inicio; i < fin; ++i) {
+                    size_t& mejor = mejores[claveDeFila(i)];
+                    if (mejor == FILA_INVALIDA || esMejor(i, mejor)) mejor = i;
+                }
+            },
+            [&](std::vector<size_t>& acumulado, const std::vector<size_t>& parcial) {
+                for (size_t k = 0; k < numClaves; ++k) {
+                    if (parcial[k] == FILA_INVALIDA) continue;
+                    if (acumulado[k] == FILA_INVALIDA || esMejor(parcial[k], acumulado[k])) {
+                        acumulado[k] = parcial[k];
+                    }
+                }
+            });
+    }
+
+    // Fila con el mayor valor de una columna (primera en caso de empate); cada hilo usa posicionMaxima
+    size_t filaMaxima(const Columna<double>& valores) {
+        return reducirEnParalelo(valores.size(), 0, FILA_INVALIDA,
+            [&](size_t inicio, size_t fin, size_t& fila) {
+                fila = inicio + posicionMaxima(valores.data() + inicio, fin - inicio);
+            },
+            [&](size_t& acumulado, size_t parcial) {
+                if (parcial != FILA_INVALIDA && (acumulado == FILA_INVALIDA || valores[parcial] > valores[acumulado])) {
+                    acumulado = parcial;
+                }
+            });
+    }
+
+    // Fila con el mayor valor de 'valores' para cada código de ciudad
+    std::vector<size_t> maximosPorCiudad(const PersonaColumns& c, const Columna<double>& valores) {
+        return mejoresPorClave(c.size(), diccionarioCiudades().size(),
+                               [&](size_t i) { return c.ciudad[i]; },
+                               [&](size_t a, size_t b) { return valores[a] > valores[b]; });
+    }
+
+    // Fila con el mayor valor de 'valores' para cada grupo (A, B, C, N)
+    std::vector<size_t> maximosPorGrupo(const PersonaColumns& c, const Columna<double>& valores) {
+        return mejoresPorClave(c.size(), NUM_GRUPOS,
+                               [&](size_t i) { return indiceGrupoConN(c.grupoDeclaracion[i]); },
+                               [&](size_t a, size_t b) { return valores[a] > valores[b]; });
+    }
+
+    /**
+     * Primera fila con la fecha mínima de [inicio, fin).
+     *
+     * CÓMO: Recorre en bloques de 4096; el mínimo de cada bloque es un std::min sin índices
+     *       ni saltos, que el compilador vectoriza. Solo el bloque que mejora el mínimo se
+     *       vuelve a leer para ubicar su primera fila, y se termina antes si aparece la
+     *       fecha más antigua posible (1/1/1960).
+     */
+    size_t filaFechaMinima(const Columna<FechaAAAAMMDD>& fechas, size_t inicio, size_t fin) {
+        if (inicio >= fin) return FILA_INVALIDA;
+
+        const size_t BLOQUE = 4096;
+        FechaAAAAMMDD minima = fechas[inicio];
+        size_t inicioMinima = inicio; // Bloque donde aparece 'minima' por primera vez
+
+        for (size_t b = inicio; b < fin && minima != FECHA_MAS_ANTIGUA; b += BLOQUE) {
+            const size_t finBloque = std::min(fin, b + BLOQUE);
+            FechaAAAAMMDD minimaBloque = minima;
+            for (size_t i = b; i < finBloque; ++i) {
+                minimaBloque = std::min(minimaBloque, fechas[i]);
+            }
+            if (minimaBloque < minima) {
+                minima = minimaBloque;
+                inicioMinima = b;
+            }
+        }
+        return std::find(fechas.begin() + inicioMinima, fechas.begin() + fin, minima) - fechas.begin();
+    }
+
+    // Índice (ciudad, grupo) de las columnas si describe sus filas y ciudades actuales; si no, nullptr
+    const IndiceCiudadGrupo* indiceCiudadGrupoVigente(const PersonaColumns& c) {
+        const IndiceCiudadGrupo& indice = c.indiceCiudadGrupo();
+        if (!indice.vigentePara(c.size()) || indice.numCiudades() != diccionarioCiudades().size()) return nullptr;
+        return &indice;
+    }
+
+    // Escribe "ID nombre patrimonio" de la fila si pertenece al grupo; true si la escribió
+    bool escribirPersonaDeGrupo(const PersonaColumns& c, size_t fila, char grupoDeclaracion, BufferTexto& salida) {
+        if (c.grupoDeclaracion[fila] != grupoDeclaracion) return false;
+        salida.agregarEntero(c.id[fila]);
+        salida.agregar(' ');
+        salida.agregar(diccionarioNombres().texto(c.nombre[fila]));
+        salida.agregar(' ');
+        salida.agregarDecimal2(c.patrimonio[fila]);
+        salida.agregar('\n');
+        return true;
+    }
+}
+
+int indiceGrupoConN(char grupo) {
+    int g = indiceGrupo(grupo);
+    return g >= 0 ? g : 3;
+}
+
+/**
+ * Implementación de buscarPorID columnar.
+ *
+ * POR QUÉ: Encontrar una fila por su ID.
+ * CÓMO: Delegando en indiceID: resta de la base si los IDs son consecutivos,
+ *       tabla hash si no lo son.
+ * PARA QUÉ: Búsquedas puntuales en tiempo constante, sin comparar strings.
+ */
+size_t buscarPorID(const PersonaColumns& columnas, uint64_t id) {
+    return columnas.indiceID.buscar(id);
+}
+
+size_t buscarMayorPatrimonio(const PersonaColumns& columnas) {
+    return filaMaxima(columnas.patrimonio);
+}
+
+size_t buscarMayorDeuda(const PersonaColumns& columnas) {
+    return filaMaxima(columnas.deudas);
+}
+
+/**
+ * Implementación de buscarPersonaMasLongevaConCondicion columnar.
+ *
+ * POR QUÉ: Encontrar la fecha de nacimiento más antigua.
+ * CÓMO: Cada hilo busca con filaFechaMinima la primera fila con la fecha mínima de su
+ *       bloque; se queda la fecha menor y, entre fechas iguales, el bloque anterior.
+ * PARA QUÉ: Un recorrido entero de 4 bytes por fila, vectorizado y repartido entre núcleos.
+ */
+size_t buscarPersonaMasLongevaConCondicion(const PersonaColumns& columnas) {
+    const Columna<FechaAAAAMMDD>& fechas = columnas.fechaNacimiento;
+    return reducirEnParalelo(fechas.size(), 0, FILA_INVALIDA,
+        [&](size_t inicio, size_t fin, size_t& fila) { fila = filaFechaMinima(fechas, inicio, fin); },
+        [&](size_t& acumulado, size_t parcial) {
+            if (parcial != FILA_INVALIDA && (acumulado == FILA_INVALIDA || fechas[parcial] < fechas[acumulado])) {
+                acumulado = parcial;
+            }
+        });
+}
+
+void buscarMayoresPatrimonioPorCiudad(const PersonaColumns& columnas) {
+    std::vector<size_t> mejores = maximosPorCiudad(columnas, columnas.patrimonio);
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "\n=== Personas con mayor patrimonio por ciudad ===\n";
+    for (size_t c = 0; c < mejores.size(); ++c) {
+        size_t f = mejores[c];
+        if (f == FILA_INVALIDA) continue;
+        std::cout << "- " << diccionarioCiudades().texto(c) << ": "
+                  << diccionarioNombres().texto(columnas.nombre[f]) << " "
+                  << diccionarioApellidos().texto(columnas.apellido[f]) << " ("
+                  << columnas.patrimonio[f] << ")\n";
+    }
+}
+
+void buscarMayoresPatrimonioPorGrupo(const PersonaColumns& columnas) {
+    std::vector<size_t> mejores = maximosPorGrupo(columnas, columnas.patrimonio);
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "\n=== Personas con mayor patrimonio por grupo de declaración ===\n";
+    for (size_t g = 0; g < mejores.size(); ++g) {
+        size_t f = mejores[g];
+        if (f == FILA_INVALIDA) continue;
+        std::cout << "- " << LETRAS_GRUPO[g] << ": "
+                  << diccionarioNombres().texto(columnas.nombre[f]) << " "
+                  << diccionarioApellidos().texto(columnas.apellido[f]) << " ("
+                  << columnas.patrimonio[f] << ")\n";
+    }
+}
+
+void buscarMayoresDeudasPorCiudad(const PersonaColumns& columnas) {
+    std::vector<size_t> mejores = maximosPorCiudad(columnas, columnas.deudas);
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "\n=== Personas con mayor deuda por ciudad ===\n";
+    for (size_t c = 0; c < mejores.size(); ++c) {
+        size_t f = mejores[c];
+        if (f == FILA_INVALIDA) continue;
+        std::cout << "- " << diccionarioCiudades().texto(c) << ": "
+                  << diccionarioNombres().texto(columnas.nombre[f]) << " "
+                  << diccionarioApellidos().texto(columnas.apellido[f]) << " ("
+                  << columnas.deudas[f] << ")\n";
+    }
+}
+
+void buscarMayoresDeudasPorGrupo(const PersonaColumns& columnas) {
+    std::vector<size_t> mejores = maximosPorGrupo(columnas, columnas.deudas);
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "\n=== Personas con mayor deuda por grupo de declaración ===\n";
+    for (size_t g = 0; g < mejores.size(); ++g) {
+        size_t f = mejores[g];
+        if (f == FILA_INVALIDA) continue;
+        std::cout << "- " << LETRAS_GRUPO[g] << ": "
+                  << diccionarioNombres().texto(columnas.nombre[f]) << " "
+                  << diccionarioApellidos().texto(columnas.apellido[f]) << " ("
+                  << columnas.deudas[f] << ")\n";
+    }
+}
+
+void mostrarPersonasMasLongevaPorCiudad(const PersonaColumns& columnas) {
+    const Columna<FechaAAAAMMDD>& fechas = columnas.fechaNacimiento;
+    std::vector<size_t> mejores = mejoresPorClave(columnas.size(), diccionarioCiudades().size(),
+                                                  [&](size_t i) { return columnas.ciudad[i]; },
+                                                  [&](size_t a, size_t b) { return fechas[a] < fechas[b]; });
+
+    std::cout << "\n=== Persona más longeva por ciudad ===\n";
+    for (size_t c = 0; c < mejores.size(); ++c) {
+        size_t f = mejores[c];
+        if (f == FILA_INVALIDA) continue;
+        std::cout << "- " << diccionarioCiudades().texto(c) << ": "
+                  << diccionarioNombres().texto(columnas.nombre[f]) << " "
+                  << diccionarioApellidos().texto(columnas.apellido[f]) << " ("
+                  << formatearFecha(columnas.fechaNacimiento[f]) << ")\n";
+    }
+}
+
+void listarPersonasGrupo(const PersonaColumns& columnas, char grupoDeclaracion, int* contador) {
+    if (!contador) { std::cerr << "[listar] contador == nullptr\n"; return; }
+
+    grupoDeclaracion = std::toupper(static_cast<unsigned char>(grupoDeclaracion));
+
+    std::cout << "Personas del grupo " << grupoDeclaracion << " encontradas:\n";
+    if (const IndiceCiudadGrupo* indice = indiceCiudadGrupoVigente(columnas)) {
+        // Solo las filas del grupo, mezcladas en orden de fila como el recorrido completo
+        const std::vector<uint32_t> filas = indice->filasDeGrupo(indiceGrupoConN(grupoDeclaracion));
+        *contador += static_cast<int>(escribirRegistros(filas.size(), hilosSalida(), [&](size_t k, BufferTexto& salida) {
+            return escribirPersonaDeGrupo(columnas, filas[k], grupoDeclaracion, salida);
+        }));
+        return;
+    }
+    *contador += static_cast<int>(escribirRegistros(columnas.size(), hilosSalida(), [&](size_t i, BufferTexto& salida) {
+        return escribirPersonaDeGrupo(columnas, i, grupoDeclaracion, salida);
+    }));
+}
+
+void listarPersonasCiudadGrupo(const PersonaColumns& columnas, CodigoCadena ciudad, char grupoDeclaracion,
+                               int* contador) {
+    if (!contador) { std::cerr << "[listar] contador == nullptr\n"; return; }
+
+    grupoDeclaracion = std::toupper(static_cast<unsigned char>(grupoDeclaracion));
+
+    std::cout << "Personas del grupo " << grupoDeclaracion << " en " << diccionarioCiudades().texto(ciudad)
+              << " encontradas:\n";
+    const IndiceCiudadGrupo* indice = indiceCiudadGrupoVigente(columnas);
+    if (indice && ciudad < indice->numCiudades()) {
+        const IndiceCiudadGrupo::Rango filas = indice->filas(ciudad, indiceGrupoConN(grupoDeclaracion));
+        *contador += static_cast<int>(escribirRegistros(filas.size(), hilosSalida(), [&](size_t k, BufferTexto& salida) {
+            return escribirPersonaDeGrupo(columnas, filas.inicio[k], grupoDeclaracion, salida);
+        }));
+        return;
+    }
+    *contador += static_cast<int>(escribirRegistros(columnas.size(), hilosSalida(), [&](size_t i, BufferTexto& salida) {
+        return columnas.ciudad[i] == ciudad && escribirPersonaDeGrupo(columnas, i, grupoDeclaracion, salida);
+    }));
+}
+
+/**
+ * Implementación de calcularGrupoMayorPorCiudad columnar.
+ *
+ * POR QUÉ: Contar personas por (ciudad, grupo) sin buscar la ciudad en un mapa de strings.
+ * CÓMO: Con indiceCiudadGrupo vigente, cada conteo es el largo de una lista del índice
+ *       y no se lee ninguna fila. Si no, el código de ciudad es directamente el índice de
+ *       la tabla de conteos; cada hilo cuenta su bloque de filas y las tablas se suman.
+ * PARA QUÉ: O(ciudades x grupos) con índice, o un recorrido de 2 bytes por fila
+ *           (ciudad + grupo) repartido entre núcleos.
+ */
+void calcularGrupoMayorPorCiudad(const PersonaColumns& columnas) {
+    const size_t numCiudades = diccionarioCiudades().size();
+    std::vector<int> conteos(numCiudades * 3, 0);
+    if (const IndiceCiudadGrupo* indice = indiceCiudadGrupoVigente(columnas)) {
+        for (size_t c = 0; c < numCiudades; ++c) {
+            for (size_t g = 0; g < 3; ++g) conteos[c * 3 + g] = static_cast<int>(indice->contar(c, g));
+        }
+    } else {
+        // Conteos por hilo que se suman al final (los enteros dan el mismo total en cualquier orden)
+        conteos = reducirEnParalelo(columnas.size(), 0, conteos,
+            [&](size_t inicio, size_t fin, std::vector<int>& parcial) {
+                for (size_t i = inicio; i < fin; ++i) {
+                    int g = indiceGrupo(columnas.grupoDeclaracion[i]);
+                    if (g >= 0) parcial[columnas.ciudad[i] * 3 + g]++;
+                }
+            },
+            [](std::vector<int>& acumulado, const std::vector<int>& parcial) {
+                for (size_t k = 0; k < acumulado.size(); ++k) acumulado[k] += parcial[k];
+            });
+    }
+
+    for (size_t c = 0; c < numCiudades; ++c) {
+        const int* grupos = &conteos[c * 3];
+        int mayorGrupo = std::max({grupos[0], grupos[1], grupos[2]});
+        char mayorGrupoLetra = (mayorGrupo == grupos[0])   ? 'A'
+                               : (mayorGrupo == grupos[1]) ? 'B'
+                                                           : 'C';
+        std::cout << "El grupo con más personas en la ciudad " << diccionarioCiudades().texto(c)
+                  << " es el grupo " << mayorGrupoLetra << " con " << mayorGrupo
+                  << " personas." << std::endl;
+    }
+}
+
+/**
+ * Implementación de calcularPromedioPatrimonio columnar.
+ *
+ * POR QUÉ: Obtener las 3 ciudades con mayor patrimonio promedio.
+ * CÓMO: Un solo recorrido de las columnas ciudad y patrimonio: el código de ciudad es
+ *       el índice de las tablas de sumas y conteos, cada hilo acumula su bloque de filas
+ *       y las tablas se suman al final. Luego ordena los promedios de mayor a menor.
+ * PARA QUÉ: Evitar la búsqueda lineal del nombre de la ciudad por cada persona y leer
+ *           cada fila una vez, sin importar cuántas ciudades haya.
+ */
+void calcularPromedioPatrimonio(const PersonaColumns& columnas) {
+    typedef std::pair<std::vector<double>, std::vector<size_t>> SumasYConteos; // Por ciudad
+    const size_t numCiudades = diccionarioCiudades().size();
+    const double* patrimonio = columnas.patrimonio.data();
+    const uint8_t* ciudades = columnas.ciudad.data();
+
+    const SumasYConteos totales = reducirEnParalelo(columnas.size(), 0,
+        SumasYConteos(std::vector<double>(numCiudades, 0.0), std::vector<size_t>(numCiudades, 0)),
+        [&](size_t inicio, size_t fin, SumasYConteos& parcial) {
+            for (size_t i = inicio; i < fin; ++i) {
+                parcial.first[ciudades[i]] += patrimonio[i];
+                parcial.second[ciudades[i]]++;
+            }
+        },
+        [numCiudades](SumasYConteos& acumulado, const SumasYConteos& parcial) {
+            for (size_t c = 0; c < numCiudades; ++c) {
+                acumulado.first[c] += parcial.first[c];
+                acumulado.second[c] += parcial.second[c];
+            }
+        });
+    const std::vector<double>& sumas = totales.first;
+    const std::vector<size_t>& conteos = totales.second;
+
+    std::vector<std::pair<double, size_t>> promediosConId;
+    for (size_t c = 0; c < sumas.size(); ++c) {
+        if (conteos[c] > 0) promediosConId.push_back({sumas[c] / conteos[c], c});
+    }
+
+    std::sort(promediosConId.begin(), promediosConId.end(),
+              [](const std::pair<double, size_t>& a, const std::pair<double, size_t>& b) {
+                  return a.first > b.first;
+              });
+
+    std::cout << "Promedio de patrimonio por ciudad:\n";
+    std::cout << std::fixed << std::setprecision(2) << std::showpoint;
+    for (size_t i = 0; i < 3 && i < promediosConId.size(); ++i) {
+        std::cout << diccionarioCiudades().texto(promediosConId[i].second) << ": "
+                  << promediosConId[i].first << std::endl;
+    }
+}
+
+size_t contarPersonas(const PersonaColumns& columnas, const FiltroConteo& filtro) {
+    const IndiceMapasBits& mapas = columnas.mapasBits();
+    if (mapas.vigentePara(columnas.size()) && mapas.numCiudades() == diccionarioCiudades().size()) {
+        std::vector<const MapaBits*> incluidos, excluidos;
+        if (filtro.grupo >= 0) incluidos.push_back(&mapas.grupo(filtro.grupo));
+        if (filtro.ciudad >= 0) incluidos.push_back(&mapas.ciudad(filtro.ciudad));
+        if (filtro.declarante == 1) incluidos.push_back(&mapas.declarantes());
+        if (filtro.declarante == 0) excluidos.push_back(&mapas.declarantes());
+        if (incluidos.size() == 1 && excluidos.empty()) return incluidos[0]->contar();
+        return MapaBits::contarInterseccion(columnas.size(), incluidos, excluidos);
+    }
+
+    // Sin mapas vigentes: recorrido de las columnas con las mismas condiciones
+    return reducirEnParalelo(columnas.size(), 0, size_t(0),
+        [&](size_t inicio, size_t fin, size_t& parcial) {
+            for (size_t i = inicio; i < fin; ++i) {
+                if (filtro.grupo >= 0 && indiceGrupoConN(columnas.grupoDeclaracion[i]) != filtro.grupo) continue;
+                if (filtro.ciudad >= 0 && columnas.ciudad[i] != filtro.ciudad) continue;
+                if (filtro.declarante >= 0 && (columnas.declaranteRenta[i] != 0) != (filtro.declarante == 1)) continue;
+                ++parcial;
+            }
+        },
+        [](size_t& acumulado, size_t parcial) { acumulado += parcial; });
+}
+
+void mostrarConteoPorGrupo(const PersonaColumns& columnas) {
+    std::cout << "\n=== Personas por grupo de declaración ===\n";
+    for (size_t g = 0; g < NUM_GRUPOS; ++g) {
+        const int grupo = static_cast<int>(g);
+        std::cout << "- " << LETRAS_GRUPO[g] << ": " << contarPersonas(columnas, FiltroConteo{grupo, -1, -1})
+                  << " personas (declarantes: " << contarPersonas(columnas, FiltroConteo{grupo, -1, 1}) << ")\n";
+    }
+    std::cout << "Declarantes de renta: " << contarPersonas(columnas, FiltroConteo{-1, -1, 1}) << " de "
+              << columnas.size() << "\n";
+}
+
+void mostrarFila(const PersonaColumns& columnas, size_t fila) {
+    if (fila >= columnas.size()) return;
+    std::cout << "-------------------------------------\n";
+    std::cout << "[" << columnas.id[fila] << "] Nombre: " << diccionarioNombres().texto(columnas.nombre[fila])
+              << " " << diccionarioApellidos().texto(columnas.apellido[fila]) << "\n";
+    std::cout << "   - Ciudad de nacimiento: " << diccionarioCiudades().texto(columnas.ciudad[fila]) << "\n";
+    std::cout << "   - Fecha de nacimiento: " << formatearFecha(columnas.fechaNacimiento[fila]) << "\n\n";
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "   - Ingresos anuales: $" << columnas.ingresosAnuales[fila] << "\n";
+    std::cout << "   - Patrimonio: $" << columnas.patrimonio[fila] << "\n";
+    std::cout << "   - Deudas: $" << columnas.deudas[fila] << "\n";
+    std::cout << "   - Declarante de renta: " << (columnas.declaranteRenta[fila] ? "Sí" : "No") << "\n";
+    std::cout << "   - Grupo de declaracion: " << columnas.grupoDeclaracion[fila] << "\n";
+}
@@ -0,0 +1,13 @@
+#include "fecha.h"
+#include <cstdio> // std::sscanf
+
+FechaAAAAMMDD fechaAAAAMMDD(const std::string& fecha) {
+    int dia = 0, mes = 0, anio = 0;
+    if (std::sscanf(fecha.c_str(), "%d/%d/%d", &dia, &mes, &anio) != 3) return 0;
+    return componerFecha(dia, mes, anio);
+}
+
+std::string formatearFecha(FechaAAAAMMDD fecha) {
+    return std::to_string(fecha % 100) + "/" + std::to_string((fecha / 100) % 100) +
+           "/" + std::to_string(fecha / 10000);
+}
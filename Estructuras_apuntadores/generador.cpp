@@ -1,4 +1,6 @@
 #include "generador.h"
+#include "paralelo.h" // ejecutarEnBloques, reducirEnParalelo
+#include "salida.h"   // escribirRegistros, hilosSalida
 #include <cstdlib>   // rand(), srand()
 #include <ctime>     // time()
 #include <random>    // Generadores aleatorios modernos
@@ -34,11 +36,52 @@ const std::vector<std::string> ciudadesColombia = {
     "Manizales", "Pasto", "Neiva", "Villavicencio", "Armenia", "Sincelejo", "Valledupar", "Montería", "Popayán", "Tunja"
 };
 
+// Todas las combinaciones "Apellido1 Apellido2"; el código es primero * N + segundo
+static std::vector<std::string> combinarApellidos() {
+    std::vector<std::string> compuestos;
+    compuestos.reserve(apellidos.size() * apellidos.size());
+    for (const std::string& primero : apellidos) {
+        for (const std::string& segundo : apellidos) {
+            compuestos.push_back(primero + " " + segundo);
+        }
+    }
+    return compuestos;
+}
+
+// Nombres femeninos seguidos de los masculinos
+static std::vector<std::string> combinarNombres() {
+    std::vector<std::string> nombres(nombresFemeninos);
+    nombres.insert(nombres.end(), nombresMasculinos.begin(), nombresMasculinos.end());
+    return nombres;
+}
+
+// Diccionarios globales, precargados con las tablas: el código de cada valor es su posición
+DiccionarioCadenas& diccionarioCiudades() {
+    static DiccionarioCadenas diccionario(ciudadesColombia);
+    return diccionario;
+}
+
+DiccionarioCadenas& diccionarioNombres() {
+    static DiccionarioCadenas diccionario(combinarNombres());
+    return diccionario;
+}
+
+DiccionarioCadenas& diccionarioApellidos() {
+    static DiccionarioCadenas diccionario(combinarApellidos());
+    return diccionario;
+}
+
+// Códigos de los valores de las tablas (mismo orden con el que se precargan los diccionarios)
+static CodigoCadena codigoNombreFemenino(size_t i) { return static_cast<CodigoCadena>(i); }
+static CodigoCadena codigoNombreMasculino(size_t i) { return static_cast<CodigoCadena>(nombresFemeninos.size() + i); }
+static CodigoCadena codigoApellido(size_t primero, size_t segundo) { return static_cast<CodigoCadena>(primero * apellidos.size() + segundo); }
+static CodigoCadena codigoCiudad(size_t i) { return static_cast<CodigoCadena>(i); }
+
 const std::vector<std::string> &ciudadesColombiaRef = ciudadesColombia;
 
 // Implementación de funciones generadoras
 
-std::string generarFechaNacimiento() {
+FechaAAAAMMDD generarFechaNacimiento() {
     // Genera día aleatorio (1-28 para simplificar)
     int dia = 1 + rand() % 28;
     // Mes aleatorio (1-12)
@@ -46,13 +89,22 @@ std::string generarFechaNacimiento() {
     // Año entre 1960-2010
     int anio = 1960 + rand() % 50;
     
-    // Convierte a string en formato DD/MM/AAAA
-    return std::to_string(dia) + "/" + std::to_string(mes) + "/" + std::to_string(anio);
+    // Empaqueta como entero AAAAMMDD (ordena igual que la fecha)
+    return componerFecha(dia, mes, anio);
 }
 
-std::string generarID() {
-    static long contador = 1000000000; // ID inicial
-    return std::to_string(contador++); // Incrementa después de usar
+FechaAAAAMMDD generarFechaNacimiento(GeneradorContador& gen) {
+    // Mismos rangos que la versión con rand(): día 1-28, mes 1-12, año 1960-2009
+    int dia = 1 + gen.enteroMenorQue(28);
+    int mes = 1 + gen.enteroMenorQue(12);
+    int anio = 1960 + gen.enteroMenorQue(50);
+
+    return componerFecha(dia, mes, anio);
+}
+
+uint64_t generarID() {
+    static uint64_t contador = 1000000000; // ID inicial
+    return contador++;                     // Incrementa después de usar
 }
 
 char grupoRenta(int id, bool declarante){
@@ -79,19 +131,20 @@ Persona generarPersona() {
     // Decide aleatoriamente si es hombre o mujer
     bool esHombre = rand() % 2;
     
-    // Selecciona nombre según género
+    // Selecciona nombre según género (solo su código en el diccionario)
     p.nombre = esHombre ? 
-        nombresMasculinos[rand() % nombresMasculinos.size()] :
-        nombresFemeninos[rand() % nombresFemeninos.size()];
+        codigoNombreMasculino(rand() % nombresMasculinos.size()) :
+        codigoNombreFemenino(rand() % nombresFemeninos.size());
     
     // Combina dos apellidos aleatorios
-    p.apellido = apellidos[rand() % apellidos.size()] + " " + 
-                 apellidos[rand() % apellidos.size()];
+    size_t primerApellido = rand() % apellidos.size();
+    size_t segundoApellido = rand() % apellidos.size();
+    p.apellido = codigoApellido(primerApellido, segundoApellido);
     
     // Genera identificadores únicos
     p.id = generarID();
     // Ciudad aleatoria de Colombia
-    p.ciudadNacimiento = ciudadesColombia[rand() % ciudadesColombia.size()];
+    p.ciudadNacimiento = codigoCiudad(rand() % ciudadesColombia.size());
     // Fecha aleatoria
     p.fechaNacimiento = generarFechaNacimiento();
     
@@ -105,13 +158,13 @@ Persona generarPersona() {
     // 70% probabilidad de ser declarante si gana > 50 millones
     p.declaranteRenta = (p.ingresosAnuales > 50000000) && (rand() % 100 > 30);
     // Grupo declaración de renta a partir del documento
-    p.grupoDeclaracion = grupoRenta(std::stoi(p.id)%100, p.declaranteRenta);
+    p.grupoDeclaracion = grupoRenta(p.id % 100, p.declaranteRenta);
     
     return p; // Retorna la estructura completa
 }
 
-std::vector<Persona> generarColeccion(int n) {
-    std::vector<Persona> personas;
+ColeccionPersonas generarColeccion(int n) {
+    ColeccionPersonas personas;
     // Reserva espacio para n personas (optimización)
     personas.reserve(n);
     
@@ -123,20 +176,134 @@ std::vector<Persona> generarColeccion(int n) {
     return personas;
 }
 
+/**
+ * Implementación de generarPersona determinista para struct.
+ *
+ * POR QUÉ: generarPersona() usa rand() y un mt19937 estático, que no se pueden compartir entre hilos.
+ * CÓMO: Mismas reglas de generación, tomando cada valor de un GeneradorContador con clave (semilla, indice).
+ * PARA QUÉ: Que la persona i sea siempre la misma sin importar qué hilo la genere.
+ */
+Persona generarPersona(uint64_t semilla, uint64_t indice) {
+    GeneradorContador gen(semilla, indice);
+    Persona p;
+
+    // Decide si es hombre o mujer
+    bool esHombre = gen.enteroMenorQue(2);
+
+    // Selecciona nombre según género (solo su código en el diccionario)
+    p.nombre = esHombre ?
+        codigoNombreMasculino(gen.enteroMenorQue(nombresMasculinos.size())) :
+        codigoNombreFemenino(gen.enteroMenorQue(nombresFemeninos.size()));
+
+    // Combina dos apellidos aleatorios
+    size_t primerApellido = gen.enteroMenorQue(apellidos.size());
+    size_t segundoApellido = gen.enteroMenorQue(apellidos.size());
+    p.apellido = codigoApellido(primerApellido, segundoApellido);
+
+    // El ID depende solo de la posición en el conjunto
+    uint64_t id = 1000000000ULL + indice;
+    p.id = id;
+
+    p.ciudadNacimiento = codigoCiudad(gen.enteroMenorQue(ciudadesColombia.size()));
+    p.fechaNacimiento = generarFechaNacimiento(gen);
+
+    // Datos económicos con los mismos rangos que generarPersona()
+    p.ingresosAnuales = gen.uniforme(10000000, 500000000);
+    p.patrimonio = gen.uniforme(0, 2000000000);
+    p.deudas = gen.uniforme(0, p.patrimonio * 0.7);
+    p.declaranteRenta = (p.ingresosAnuales > 50000000) && (gen.enteroMenorQue(100) > 30);
+    p.grupoDeclaracion = grupoRenta(id % 100, p.declaranteRenta);
+
+    return p;
+}
+
+/**
+ * Implementación de generarColeccionParalela.
+ *
+ * POR QUÉ: La generación secuencial usa un solo núcleo.
+ * CÓMO: El vector se dimensiona de una vez y cada hilo escribe su bloque contiguo
+ *       [inicio, fin) con generarPersona(semilla, i); no hay estado compartido.
+ * PARA QUÉ: Crear 10M personas en paralelo con resultado reproducible.
+ */
+ColeccionPersonas generarColeccionParalela(int n, uint64_t semilla, unsigned hilos) {
+    if (n <= 0) return ColeccionPersonas();
+
+    ColeccionPersonas personas(n);
 
-const Persona* buscarPorID(const std::vector<Persona>& personas, const std::string& id) {
-    // Usamos lower_bound para encontrar la posición del primer elemento no menor que 'id'
-    auto it = std::lower_bound(personas.begin(), personas.end(), id,
-        [](const Persona& p, const std::string& id) {
-            return p.id < id;  // Compara por el ID de la persona
+    ejecutarEnBloques(personas.size(), hilos,
+        [&personas, semilla](size_t inicio, size_t fin, unsigned) {
+            for (size_t i = inicio; i < fin; ++i) {
+                personas[i] = generarPersona(semilla, i);
+            }
         });
 
-    // Verificamos si encontramos el elemento exacto
-    if (it != personas.end() && it->id == id) {
-        return &(*it);  // Retorna un puntero a la persona encontrada
-    } else {
-        return nullptr;  // Si no se encuentra, devuelve nullptr
+    return personas;
+}
+
+// Cada hilo agrega su tramo de índices en su propio AgregadoEnFlujo; los tramos se combinan
+// en orden, así que el resultado es el de las consultas sobre generarColeccionParalela(n, semilla)
+AgregadoEnFlujo generarYAgregar(uint64_t n, uint64_t semilla, unsigned hilos) {
+    return reducirEnParalelo(static_cast<size_t>(n), hilos, AgregadoEnFlujo(),
+        [semilla](size_t inicio, size_t fin, AgregadoEnFlujo& parcial) {
+            for (size_t i = inicio; i < fin; ++i) {
+                const Persona p = generarPersona(semilla, i);
+                parcial.agregar(p.id, p.nombre, p.apellido, p.ciudadNacimiento, p.grupoDeclaracion, p.patrimonio);
+            }
+        },
+        [](AgregadoEnFlujo& acumulado, const AgregadoEnFlujo& parcial) { acumulado.combinar(parcial); });
+}
+
+// Construye el almacén columnar: copia los códigos de diccionario y la fecha AAAAMMDD
+PersonaColumns construirColumnas(const ColeccionPersonas* personas) {
+    PersonaColumns columnas;
+    if (!personas) return columnas;
+    columnas.reservar(personas->size());
+
+    for (const Persona& p : *personas) {
+        columnas.id.push_back(p.id);
+        columnas.nombre.push_back(p.nombre);
+        columnas.apellido.push_back(p.apellido);
+        columnas.fechaNacimiento.push_back(p.fechaNacimiento);
+        columnas.ciudad.push_back(static_cast<uint8_t>(p.ciudadNacimiento));
+        columnas.ingresosAnuales.push_back(p.ingresosAnuales);
+        columnas.patrimonio.push_back(p.patrimonio);
+        columnas.deudas.push_back(p.deudas);
+        columnas.declaranteRenta.push_back(p.declaranteRenta ? 1 : 0);
+        columnas.grupoDeclaracion.push_back(p.grupoDeclaracion);
+    }
+    columnas.indexarIDs();
+    return columnas;
+}
+
+// Colección de personas a partir de las columnas (inversa de construirColumnas)
+ColeccionPersonas construirPersonas(const PersonaColumns& columnas) {
+    ColeccionPersonas personas;
+    personas.reserve(columnas.size());
+
+    for (size_t i = 0; i < columnas.size(); ++i) {
+        personas.push_back(Persona{columnas.nombre[i], columnas.apellido[i], columnas.id[i],
+                                   static_cast<CodigoCadena>(columnas.ciudad[i]), columnas.fechaNacimiento[i],
+                                   columnas.ingresosAnuales[i], columnas.patrimonio[i], columnas.deudas[i],
+                                   columnas.declaranteRenta[i] != 0, columnas.grupoDeclaracion[i]});
     }
+    return personas;
+}
+
+
+// Índice ID -> fila de la colección (ver indice_id.h)
+IndiceID construirIndiceID(const ColeccionPersonas* personas) {
+    IndiceID indice;
+    indice.construir(personas->size(), [personas](size_t i) { return (*personas)[i].id; });
+    return indice;
+}
+
+// Fila por índice en O(1); se confirma el ID por si el índice quedó desactualizado
+const Persona* buscarPorID(const ColeccionPersonas& personas, const IndiceID& indice, uint64_t id) {
+    size_t fila = indice.buscar(id);
+    if (fila < personas.size() && personas[fila].id == id) {
+        return &personas[fila];  // Retorna un puntero a la persona encontrada
+    }
+    return nullptr;  // Si no se encuentra, devuelve nullptr
 }
 
 
@@ -149,7 +316,7 @@ const Persona* buscarPorID(const std::vector<Persona>& personas, const std::stri
  * PARA QUÉ: Obtener información de la persona con mayor patrimonio en el país
  *           para su posterior visualización o procesamiento.
  */
-const Persona* buscarMayorPatrimonio(const std::vector<Persona>* personas) {
+const Persona* buscarMayorPatrimonio(const ColeccionPersonas* personas) {
     // Si no hay personas en la colección, no hay máximo que buscar
     if (personas->empty()) return nullptr;
 
@@ -169,18 +336,18 @@ const Persona* buscarMayorPatrimonio(const std::vector<Persona>* personas) {
  * Implementación de buscarPersonaMasLongevaConCondicion--
  * 
  * POR QUÉ: Encontrar la persona más longeva (con la fecha de nacimiento más antigua) en una colección de personas.
- * CÓMO: Recorriendo el vector de personas y comparando fechas de nacimiento; si se encuentra la fecha más antigua posible, termina la búsqueda anticipadamente.
+ * CÓMO: Recorriendo el vector de personas y comparando fechas de nacimiento como enteros AAAAMMDD (orden cronológico); si se encuentra la fecha más antigua posible, termina la búsqueda anticipadamente.
  * PARA QUÉ: Para obtener rápidamente la persona más longeva en el país, optimizando el tiempo si aparece la fecha mínima.
  */
-const Persona* buscarPersonaMasLongevaConCondicion(const std::vector<Persona>* personas) { //toma el vector de Persona como input
+const Persona* buscarPersonaMasLongevaConCondicion(const ColeccionPersonas* personas) { //toma el vector de Persona como input
     if (personas->empty()) return nullptr;
 
-    const std::string fechaObjetivo = "1/1/1960";  //fecha mas antigua posible
+    const FechaAAAAMMDD fechaObjetivo = FECHA_MAS_ANTIGUA;  // fecha más antigua posible
     const Persona* masLongeva = &(*personas)[0];  //inicialización de puntero con primera Persona
-    std::string fechaMasLongeva = masLongeva->fechaNacimiento;   
+    FechaAAAAMMDD fechaMasLongeva = masLongeva->fechaNacimiento;   
 
     for (size_t i = 1; i < personas->size(); ++i) {  //recorrido del vector desde la seguna Persona
-        const std::string fechaActual = (*personas)[i].fechaNacimiento;
+        const FechaAAAAMMDD fechaActual = (*personas)[i].fechaNacimiento;
         if (fechaActual < fechaMasLongeva) {   
             masLongeva = &(*personas)[i];  //actualiza puntero despues de comparación
             fechaMasLongeva = masLongeva->fechaNacimiento;
@@ -196,33 +363,29 @@ const Persona* buscarPersonaMasLongevaConCondicion(const std::vector<Persona>* p
  * Implementación de mostrarPersonasMasLongevaPorCiudad_Vector.
  * 
  * POR QUÉ: Mostrar la persona más longeva de cada ciudad en una colección de personas.
- * CÓMO: Recorriendo el vector de personas, agrupando por ciudad y comparando fechas de nacimiento para cada grupo.
+ * CÓMO: Recorriendo el vector de personas; el código de ciudad indexa la persona más longeva de cada ciudad.
  * PARA QUÉ: Para visualizar, por ciudad, quién es la persona más longeva, útil para estadísticas y reportes por región.
  */
-void mostrarPersonasMasLongevaPorCiudad_Vector(const std::vector<Persona>* personas) { //recibe referencia
-    std::vector<std::pair<std::string, const Persona*>> resultado; //lista dinamica de pares (ciudad, persona*) 
+void mostrarPersonasMasLongevaPorCiudad_Vector(const ColeccionPersonas* personas) { //recibe referencia
+    // Persona más longeva de cada ciudad, indexada por código de ciudad
+    std::vector<const Persona*> resultado(diccionarioCiudades().size(), nullptr);
 
     for (const auto& persona : *personas) {  
-        std::string ciudad = persona.ciudadNacimiento;
-        auto iter = std::find_if(resultado.begin(), resultado.end(), //observa si ya hay un par con esa ciudad
-            [&ciudad](const std::pair<std::string, const Persona*>& par) {  //compara el  par guardado con ciudad (de la iteración)
-                return par.first == ciudad;
-            });
-        if (iter == resultado.end()) { //si no está la ciudad, se agrega
-            resultado.push_back({ciudad, &persona});
-        } else {  //si ya está,compara fechas con la persona(second) y actualiza si es necesario
-            if (persona.fechaNacimiento < iter->second->fechaNacimiento) {
-                iter->second = &persona;
-            }
+        const Persona*& masLongeva = resultado[persona.ciudadNacimiento];
+        if (masLongeva == nullptr) { //si la ciudad no tenía persona, se asigna
+            masLongeva = &persona;
+        } else if (persona.fechaNacimiento < masLongeva->fechaNacimiento) {
+            masLongeva = &persona; //si ya tenía, compara fechas y actualiza si es necesario
         }
     }
 
     std::cout << "\n=== Persona más longeva por ciudad ===\n";
-    for (const auto& par : resultado) {
-        std::cout << "- " << par.first << ": "
-                  << par.second->nombre << " "
-                  << par.second->apellido << " ("
-                  << par.second->fechaNacimiento << ")\n";
+    for (size_t c = 0; c < resultado.size(); ++c) {
+        if (!resultado[c]) continue;
+        std::cout << "- " << diccionarioCiudades().texto(c) << ": "
+                  << resultado[c]->textoNombre() << " "
+                  << resultado[c]->textoApellido() << " ("
+                  << resultado[c]->textoFecha() << ")\n";
     }
 }
 
@@ -230,25 +393,20 @@ void mostrarPersonasMasLongevaPorCiudad_Vector(const std::vector<Persona>* perso
  * Imprime un listado de las personas con mayor patrimonio en cada ciudad.
  * 
  * POR QUÉ: Encontrar a la persona con mayor patrimonio en cada ciudad de Colombia.
- * CÓMO: Usando un mapa temporal para ir guardando, por ciudad, la persona con
- *       mayor patrimonio encontrada hasta el momento.
+ * CÓMO: El código de ciudad indexa un arreglo con la persona de
+ *       mayor patrimonio encontrada hasta el momento (sin hash de strings).
  * PARA QUÉ: Listar y mostrar personas con mayor patrimonio por ciudad.
  */
 
 // Busca e imprime la persona con mayor patrimonio por cada ciudad
-void buscarMayoresPatrimonioPorCiudad(const std::vector<Persona>* personas) {
-  // Mapa que guarda, para cada ciudad, un puntero a la Persona con mayor patrimonio
-
-  std::unordered_map<std::string, const Persona*> mayoresPorCiudad;
-  mayoresPorCiudad.reserve(64); // Reserva aproximada para evitar rehashes innecesarios
+void buscarMayoresPatrimonioPorCiudad(const ColeccionPersonas* personas) {
+  // Arreglo indexado por código de ciudad con un puntero a la Persona de mayor patrimonio
+  std::vector<const Persona*> mayoresPorCiudad(diccionarioCiudades().size(), nullptr);
 
   // Recorremos todas las personas y seleccionamos la de mayor patrimonio por ciudad
   for (const auto& p : *personas) {
-      const std::string& ciudad = p.ciudadNacimiento; // obtenemos la ciudad
-
-      // Referencia al puntero asociado a esa ciudad en el mapa.
-      // Si la ciudad no existe aún, se crea con valor nullptr.
-      const Persona*& best = mayoresPorCiudad[ciudad];
+      // Referencia al puntero asociado a esa ciudad (nullptr si aún no hay persona)
+      const Persona*& best = mayoresPorCiudad[p.ciudadNacimiento];
 
       // Si no había persona registrada o esta tiene más patrimonio, actualizamos
       if (best == nullptr || p.patrimonio > best->patrimonio) {
@@ -262,16 +420,15 @@ void buscarMayoresPatrimonioPorCiudad(const std::vector<Persona>* personas) {
   // Configuramos el formato: fijo, con decimales (2) → se imprime como decimal
   std::cout << std::fixed << std::setprecision(2);
 
-  // Recorremos el mapa e imprimimos los resultados
-  for (const auto& kv : mayoresPorCiudad) {
-      const std::string& ciudad = kv.first;   // clave del mapa = ciudad
-      const Persona* persona = kv.second;     // valor = puntero a Persona
-      if (!persona) continue;                 // seguridad por si hubiera nulos
+  // Recorremos las ciudades en orden de código e imprimimos los resultados
+  for (size_t c = 0; c < mayoresPorCiudad.size(); ++c) {
+      const Persona* persona = mayoresPorCiudad[c];
+      if (!persona) continue;                 // ciudad sin personas
 
       // Mostramos ciudad y datos de la persona con mayor patrimonio
-      std::cout << "- " << ciudad << ": "
-                << persona->nombre << " "
-                << persona->apellido << " ("
+      std::cout << "- " << diccionarioCiudades().texto(c) << ": "
+                << persona->textoNombre() << " "
+                << persona->textoApellido() << " ("
                 << persona->patrimonio << ")\n";
   }
 }
@@ -285,7 +442,7 @@ void buscarMayoresPatrimonioPorCiudad(const std::vector<Persona>* personas) {
  * PARA QUÉ: Listar y mostrar personas con mayor patrimonio por grupo.
  */
  // Busca e imprime la persona con mayor patrimonio por cada grupo
-void buscarMayoresPatrimonioPorGrupo(const std::vector<Persona>* personas) {
+void buscarMayoresPatrimonioPorGrupo(const ColeccionPersonas* personas) {
   // Mapa que guarda, para cada grupo (char), un puntero a la Persona con mayor patrimonio encontrada
   std::unordered_map<char, const Persona*> mayoresPorGrupo;
   mayoresPorGrupo.reserve(personas->size()); // Reservamos espacio (si son pocos grupos, esto se puede ajustar)
@@ -317,8 +474,8 @@ void buscarMayoresPatrimonioPorGrupo(const std::vector<Persona>* personas) {
 
       // Imprimimos el grupo y los datos de la persona con mayor patrimonio
       std::cout << "- " << grupo << ": "
-                << persona->nombre << " "
-                << persona->apellido << " ("
+                << persona->textoNombre() << " "
+                << persona->textoApellido() << " ("
                 << persona->patrimonio << ")\n";
   }
 }
@@ -331,7 +488,7 @@ void buscarMayoresPatrimonioPorGrupo(const std::vector<Persona>* personas) {
  * PARA QUÉ: Listar y mostrar personas que si pertencen.
  */
  // Busca e imprime la persona con mayor patrimonio por cada grupo. 
-void listarPersonasGrupo(const std::vector<Persona>* personas,char grupoDeclaracion,int* contador) {
+void listarPersonasGrupo(const ColeccionPersonas* personas,char grupoDeclaracion,int* contador) {
     if (!personas) { std::cerr << "[listar] personas == nullptr\n"; return; }
     if (!contador) { std::cerr << "[listar] contador == nullptr\n"; return; }
 
@@ -339,124 +496,54 @@ void listarPersonasGrupo(const std::vector<Persona>* personas,char grupoDeclarac
     grupoDeclaracion = std::toupper(static_cast<unsigned char>(grupoDeclaracion));
 
     std::cout << "Personas del grupo " << grupoDeclaracion << " encontradas:\n";
-    for (const Persona& p : *personas) {
-        if (p.grupoDeclaracion== grupoDeclaracion) {
-            std::cout << p.id << " " << p.nombre << " " << p.patrimonio << "\n";
-            ++(*contador);
-        }
-    }
+    // Las líneas se formatean en búferes y se escriben por bloques (ver salida.h)
+    *contador += static_cast<int>(escribirRegistros(personas->size(), hilosSalida(), [&](size_t i, BufferTexto& salida) {
+        const Persona& p = (*personas)[i];
+        if (p.grupoDeclaracion != grupoDeclaracion) return false;
+        salida.agregarEntero(p.id);
+        salida.agregar(' ');
+        salida.agregar(p.textoNombre());
+        salida.agregar(' ');
+        salida.agregarDecimal2(p.patrimonio);
+        salida.agregar('\n');
+        return true;
+    }));
 }
 
 /**
  * Implementación de calcularGrupoMayorPorCiudad.
  * 
  * POR QUÉ: Calcular el grupo con más personas en cada ciudad.
- * CÓMO: Recorriendo el vector de personas, agrupando por grupo y las cantidades de cada grupo por ciudad.
+ * CÓMO: Recorriendo el vector de personas y contando cada grupo en la fila de su código de ciudad.
  * PARA QUÉ: Para visualizar, por ciudad, cuál es el grupo con más personas, útil para estadísticas y reportes por región.
  */
 // Función para calcular el grupo más grande por ciudad
-void calcularGrupoMayorPorCiudad(const std::vector<Persona> *personas) {
-  // Inicialización de las variables
-  int ciudadesGrupos[20][3] = {{0}}; // 20 ciudades, 3 grupos
-  std::unordered_map<std::string, int> ciudadIndex = {
-      {"Bogotá", 0},       {"Medellín", 1},       {"Cali", 2},
-      {"Barranquilla", 3}, {"Cartagena", 4},      {"Bucaramanga", 5},
-      {"Pereira", 6},      {"Santa Marta", 7},    {"Cúcuta", 8},
-      {"Ibagué", 9},       {"Manizales", 10},     {"Pasto", 11},
-      {"Neiva", 12},       {"Villavicencio", 13}, {"Armenia", 14},
-      {"Sincelejo", 15},   {"Valledupar", 16},    {"Montería", 17},
-      {"Popayán", 18},     {"Tunja", 19}};
+void calcularGrupoMayorPorCiudad(const ColeccionPersonas *personas) {
+  // Conteo por (ciudad, grupo): el código de ciudad es directamente la fila
+  const size_t numCiudades = diccionarioCiudades().size();
+  std::vector<int> ciudadesGrupos(numCiudades * 3, 0); // 3 grupos por ciudad
 
   // Recorremos las personas y sumamos los grupos
   for (const Persona &persona : *personas) {
-    std::string ciudad = persona.ciudadNacimiento;
     char grupo = persona.grupoDeclaracion;
-
-    int index1 = ciudadIndex[ciudad];
     if (grupo != 'N') {
       int index2 = (grupo == 'A' ? 0 : (grupo == 'B' ? 1 : 2));
-      ciudadesGrupos[index1][index2]++;
+      ciudadesGrupos[persona.ciudadNacimiento * 3 + index2]++;
     }
   }
 
   // Mostrar el grupo mayor por ciudad
-  for (int i = 0; i < 20; i++) {
-    std::string ciudad;
-    switch (i) {
-    case 0:
-      ciudad = "Bogotá";
-      break;
-    case 1:
-      ciudad = "Medellín";
-      break;
-    case 2:
-      ciudad = "Cali";
-      break;
-    case 3:
-      ciudad = "Barranquilla";
-      break;
-    case 4:
-      ciudad = "Cartagena";
-      break;
-    case 5:
-      ciudad = "Bucaramanga";
-      break;
-    case 6:
-      ciudad = "Pereira";
-      break;
-    case 7:
-      ciudad = "Santa Marta";
-      break;
-    case 8:
-      ciudad = "Cúcuta";
-      break;
-    case 9:
-      ciudad = "Ibagué";
-      break;
-    case 10:
-      ciudad = "Manizales";
-      break;
-    case 11:
-      ciudad = "Pasto";
-      break;
-    case 12:
-      ciudad = "Neiva";
-      break;
-    case 13:
-      ciudad = "Villavicencio";
-      break;
-    case 14:
-      ciudad = "Armenia";
-      break;
-    case 15:
-      ciudad = "Sincelejo";
-      break;
-    case 16:
-      ciudad = "Valledupar";
-      break;
-    case 17:
-      ciudad = "Montería";
-      break;
-    case 18:
-      ciudad = "Popayán";
-      break;
-    case 19:
-      ciudad = "Tunja";
-      break;
-    default:
-      ciudad = "Ciudad no encontrada";
-      break;
-    }
+  for (size_t i = 0; i < numCiudades; i++) {
+    const int *grupos = &ciudadesGrupos[i * 3];
 
     // Encontramos el grupo con más personas
-    int mayorGrupo = std::max(
-        {ciudadesGrupos[i][0], ciudadesGrupos[i][1], ciudadesGrupos[i][2]});
-    char mayorGrupoLetra = (mayorGrupo == ciudadesGrupos[i][0])   ? 'A'
-                           : (mayorGrupo == ciudadesGrupos[i][1]) ? 'B'
-                                                                  : 'C';
+    int mayorGrupo = std::max({grupos[0], grupos[1], grupos[2]});
+    char mayorGrupoLetra = (mayorGrupo == grupos[0])   ? 'A'
+                           : (mayorGrupo == grupos[1]) ? 'B'
+                                                       : 'C';
 
     // Mostramos el resultado
-    std::cout << "El grupo con más personas en la ciudad " << ciudad
+    std::cout << "El grupo con más personas en la ciudad " << diccionarioCiudades().texto(i)
               << " es el grupo " << mayorGrupoLetra << " con " << mayorGrupo
               << " personas." << std::endl;
   }
@@ -470,36 +557,27 @@ void calcularGrupoMayorPorCiudad(const std::vector<Persona> *personas) {
  * PARA QUÉ: Para visualizar, en el país, las 3 ciudades con el promedio de patrimonio más alto, útil para estadísticas y reportes de la región.
  */
 // Función que calcula el promedio de patrimonio por ciudad
-void calcularPromedioPatrimonio(const std::vector<Persona> *personas) {
-  double ciudadesPromedios[20] = {0};
-  int conteoCiudad[20] = {0};
+void calcularPromedioPatrimonio(const ColeccionPersonas *personas) {
+  // Sumas y conteos indexados por código de ciudad
+  const size_t numCiudades = diccionarioCiudades().size();
+  std::vector<double> ciudadesPromedios(numCiudades, 0.0);
+  std::vector<int> conteoCiudad(numCiudades, 0);
 
   // Recorremos a cada persona y sumamos el patrimonio por ciudad
   for (const Persona &persona : *personas) {
-    std::string ciudad = persona.ciudadNacimiento;
-    double patrimonio = persona.patrimonio;
-
-    // Buscar el índice de la ciudad
-    int index1;
-    for (int i = 0; i < 20; i++) {
-      if (ciudadesColombiaRef[i] == ciudad) {
-        index1 = i;
-        break;
-      }
-    }
-    // Incrementamos la cuenta de personas y sumamos el patrimonio
-    ciudadesPromedios[index1] += patrimonio;
-    conteoCiudad[index1]++;
+    CodigoCadena ciudad = persona.ciudadNacimiento;
+    ciudadesPromedios[ciudad] += persona.patrimonio;
+    conteoCiudad[ciudad]++;
   }
   // Creamos un arreglo de pares (promedio, idCiudad) para ordenar
   std::vector<std::pair<float, int>> promediosConId;
 
   // Calculamos los promedios y agregarlos con su ID
-  for (int i = 0; i < 20; i++) {
+  for (size_t i = 0; i < numCiudades; i++) {
     if (conteoCiudad[i] > 0) { // Si hay al menos una persona en esa ciudad
       float promedio = ciudadesPromedios[i] / conteoCiudad[i];
       promediosConId.push_back(
-          {promedio, i}); // Guardar el promedio junto con el ID de la ciudad
+          {promedio, static_cast<int>(i)}); // Guardar el promedio junto con el ID de la ciudad
     }
   }
 
@@ -518,9 +596,9 @@ void calcularPromedioPatrimonio(const std::vector<Persona> *personas) {
                    2); // Fija a dos decimales y evita notación científica
   std::cout << std::showpoint; // Asegura que se muestren los ceros decimales
 
-  for (int i = 0; i < 3 && i < promediosConId.size(); ++i) {
+  for (size_t i = 0; i < 3 && i < promediosConId.size(); ++i) {
     int idCiudad = promediosConId[i].second; // Obtenemos el ID de la ciudad
-    std::cout << ciudadesColombia[idCiudad] << ": " << promediosConId[i].first
+    std::cout << diccionarioCiudades().texto(idCiudad) << ": " << promediosConId[i].first
               << std::endl;
   }
 }
@@ -534,7 +612,7 @@ void calcularPromedioPatrimonio(const std::vector<Persona> *personas) {
  * PARA QUÉ: Obtener información de la persona con mayor deuda
  *           para su posterior visualización o procesamiento.
  */
-const Persona* buscarMayorDeuda(const std::vector<Persona>* personas) {
+const Persona* buscarMayorDeuda(const ColeccionPersonas* personas) {
     // Si no hay personas en la colección, no hay máximo que buscar
     if (personas->empty()) return nullptr;
 
@@ -553,26 +631,44 @@ const Persona* buscarMayorDeuda(const std::vector<Persona>* personas) {
  * Imprime un listado de las personas con mayor deuda en cada ciudad.
  * 
  * POR QUÉ: Encontrar a la persona con mayor deuda en cada ciudad de la colección.
- * CÓMO: Usando un mapa temporal para ir guardando, por ciudad, la persona con
- *       mayor deuda encontrada hasta el momento.
+ * CÓMO: El código de ciudad indexa un arreglo con la persona de
+ *       mayor deuda encontrada hasta el momento (sin hash de strings).
  * PARA QUÉ: Listar y mostrar personas con mayor deuda por ciudad.
  */
- void buscarMayoresDeudasPorCiudad(const std::vector<Persona>* personas) {
-  // Mapa que guarda, para cada ciudad, un puntero a la Persona con mayor deuda encontrada
-  std::unordered_map<std::string, const Persona*> mayoresPorCiudad;
-  mayoresPorCiudad.reserve(personas->size()); // Reservamos (se puede ajustar según nº de ciudades)
+ void buscarMayoresDeudasPorCiudad(const ColeccionPersonas* personas) {
+  // Arreglo indexado por código de ciudad con un puntero a la Persona de mayor deuda
+  std::vector<const Persona*> mayoresPorCiudad(diccionarioCiudades().size(), nullptr);
 
   // Recorremos todas las personas y actualizamos si encontramos mayor deuda en la ciudad
   for (const auto& p : *personas) {
-      const std::string& ciudad = p.ciudadNacimiento; // ciudad asociada a la persona
-      auto it = mayoresPorCiudad.find(ciudad);
+      const Persona*& best = mayoresPorCiudad[p.ciudadNacimiento];
 
-      // Si la ciudad no estaba o la persona actual tiene más deuda, actualizamos
-      if (it == mayoresPorCiudad.end() || p.deudas > it->second->deudas) {
-          mayoresPorCiudad[ciudad] = &p;
+      // Si la ciudad no tenía persona o la actual tiene más deuda, actualizamos
+      if (best == nullptr || p.deudas > best->deudas) {
+          best = &p;
       }
   }
- }
+
+  // Encabezado del reporte
+  std::cout << "\n=== Personas con mayor deuda por ciudad ===\n";
+
+  // Configuramos el formato de salida una sola vez:
+  // - std::fixed: evita notación científica
+  // - std::setprecision(2): con dos decimales → valor decimal
+  std::cout << std::fixed << std::setprecision(2);
+
+  // Recorremos las ciudades en orden de código e imprimimos los resultados
+  for (size_t c = 0; c < mayoresPorCiudad.size(); ++c) {
+      const Persona* persona = mayoresPorCiudad[c];
+      if (!persona) continue;               // ciudad sin personas
+
+      // Mostramos ciudad y datos de la persona con mayor deuda
+      std::cout << "- " << diccionarioCiudades().texto(c) << ": "
+                << persona->textoNombre() << " "
+                << persona->textoApellido() << " ("
+                << persona->deudas << ")\n";
+  }
+}
 
 
 /**
@@ -584,7 +680,7 @@ const Persona* buscarMayorDeuda(const std::vector<Persona>* personas) {
  * PARA QUÉ: Listar y mostrar personas con mayor deuda por grupo.
  */
 // Busca e imprime la persona con mayor deuda por cada grupo
-void buscarMayoresDeudasPorGrupo(const std::vector<Persona>* personas) {
+void buscarMayoresDeudasPorGrupo(const ColeccionPersonas* personas) {
   // Mapa que guarda, para cada grupo (char), un puntero a la Persona con mayor deuda encontrada
   std::unordered_map<char, const Persona*> mayoresPorGrupo;
   mayoresPorGrupo.reserve(personas->size()); // Reservamos (puede ser mucho para pocos grupos, ajustar si hace falta)
@@ -618,8 +714,8 @@ void buscarMayoresDeudasPorGrupo(const std::vector<Persona>* personas) {
 
       // Imprimimos grupo y datos de la persona con mayor deuda
       std::cout << "- " << grupo << ": "
-                << persona->nombre << " "
-                << persona->apellido << " ("
+                << persona->textoNombre() << " "
+                << persona->textoApellido() << " ("
                 << persona->deudas << ")\n";
   }
 }
@@ -2,15 +2,23 @@
 #define GENERADOR_H
 
 #include "persona.h"
+#include "agregados.h"
+#include "aleatorio.h"
+#include "columnas.h"
+#include "indice_id.h"
+#include <cstdint>
 #include <vector>
 
 // --- Funciones para generación de datos aleatorios ---
 
-// Genera fecha aleatoria entre 1960-2010
-std::string generarFechaNacimiento();
+// Genera fecha aleatoria entre 1960-2010 (entero AAAAMMDD)
+FechaAAAAMMDD generarFechaNacimiento();
+
+// Genera fecha aleatoria con un generador basado en contador (seguro entre hilos)
+FechaAAAAMMDD generarFechaNacimiento(GeneradorContador& gen);
 
 // Genera ID único secuencial
-std::string generarID();
+uint64_t generarID();
 
 // Genera número decimal en rango [min, max]
 double randomDouble(double min, double max);
@@ -18,35 +26,55 @@ double randomDouble(double min, double max);
 // Crea una persona con datos aleatorios
 Persona generarPersona();
 
+// Crea la persona número 'indice' de forma determinista a partir de (semilla, indice)
+// El ID es 1000000000 + indice, sin contador global
+Persona generarPersona(uint64_t semilla, uint64_t indice);
+
 // Genera colección de n personas
-std::vector<Persona> generarColeccion(int n);
+ColeccionPersonas generarColeccion(int n);
+
+// Genera colección de n personas repartida entre varios hilos (0 = todos los núcleos)
+// El resultado es idéntico para cualquier número de hilos con la misma semilla
+ColeccionPersonas generarColeccionParalela(int n, uint64_t semilla, unsigned hilos);
+
+// Genera n personas como generarColeccionParalela pero pasa cada una a un AgregadoEnFlujo
+// y la descarta: memoria O(ciudades x grupos) para cualquier n (ver agregados.h)
+AgregadoEnFlujo generarYAgregar(uint64_t n, uint64_t semilla, unsigned hilos);
+
+// Convierte la colección al almacén columnar (ver columnas.h)
+PersonaColumns construirColumnas(const ColeccionPersonas* personas);
+
+// Reconstruye la colección a partir del almacén columnar (p. ej. tras cargar una instantánea)
+ColeccionPersonas construirPersonas(const PersonaColumns& columnas);
+
+// Construye el índice ID -> fila (acceso directo si los IDs son consecutivos, hash si no)
+IndiceID construirIndiceID(const ColeccionPersonas* personas);
 
-// Busca persona por ID en un vector
+// Busca persona por ID usando el índice de la misma colección (O(1))
 // Retorna puntero a persona si la encuentra, nullptr si no
-// Búsqueda por ID usando punteros (structs con campos públicos)
-const Persona* buscarPorID(const std::vector<Persona>& personas, const std::string& id);
+const Persona* buscarPorID(const ColeccionPersonas& personas, const IndiceID& indice, uint64_t id);
 
-const Persona* buscarMayorPatrimonio(const std::vector<Persona>* personas);
+const Persona* buscarMayorPatrimonio(const ColeccionPersonas* personas);
 
-void buscarMayoresPatrimonioPorCiudad(const std::vector<Persona>* personas);
+void buscarMayoresPatrimonioPorCiudad(const ColeccionPersonas* personas);
 
-const Persona* buscarPersonaMasLongevaConCondicion(const std::vector<Persona>* personas) ;
+const Persona* buscarPersonaMasLongevaConCondicion(const ColeccionPersonas* personas) ;
 
-void buscarMayoresPatrimonioPorGrupo(const std::vector<Persona>* personas);
+void buscarMayoresPatrimonioPorGrupo(const ColeccionPersonas* personas);
 
-void listarPersonasGrupo(const std::vector<Persona>* personas,char grupoDeclaracion,int* contador);
+void listarPersonasGrupo(const ColeccionPersonas* personas,char grupoDeclaracion,int* contador);
 
-void calcularGrupoMayorPorCiudad(const std::vector<Persona> *personas);
+void calcularGrupoMayorPorCiudad(const ColeccionPersonas *personas);
 
-void calcularPromedioPatrimonio(const std::vector<Persona> *personas);
+void calcularPromedioPatrimonio(const ColeccionPersonas *personas);
 
-const Persona* buscarMayorDeuda(const std::vector<Persona>* personas);
+const Persona* buscarMayorDeuda(const ColeccionPersonas* personas);
 
-void buscarMayoresDeudasPorCiudad(const std::vector<Persona>* personas) ;
+void buscarMayoresDeudasPorCiudad(const ColeccionPersonas* personas) ;
 
-void buscarMayoresDeudasPorGrupo(const std::vector<Persona>* personas);
+void buscarMayoresDeudasPorGrupo(const ColeccionPersonas* personas);
 
-void mostrarPersonasMasLongevaPorCiudad_Vector(const std::vector<Persona>* personas);
+void mostrarPersonasMasLongevaPorCiudad_Vector(const ColeccionPersonas* personas);
 
 
 
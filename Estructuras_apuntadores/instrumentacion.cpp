@@ -0,0 +1,99 @@
+#include "instrumentacion.h"
+#include <atomic>
+#include <cstdlib> // std::malloc, std::free
+#include <new>     // std::bad_alloc, std::nothrow_t
+
+const char* const NOMBRES_INSTRUMENTOS[NUM_INSTRUMENTOS] = {
+    "Copias", "Movimientos", "Reservas", "BytesReservados", "Liberaciones"
+};
+
+namespace {
+    // Cuentas de los hilos que ya terminaron
+    std::atomic<unsigned long long> totales_[NUM_INSTRUMENTOS];
+
+    // Cuentas del hilo actual; al terminar el hilo se suman a totales_
+    struct ContadoresHilo {
+        unsigned long long valores[NUM_INSTRUMENTOS];
+
+        ~ContadoresHilo() {
+            for (int k = 0; k < NUM_INSTRUMENTOS; ++k) {
+                totales_[k].fetch_add(valores[k], std::memory_order_relaxed);
+                valores[k] = 0;
+            }
+        }
+    };
+
+    thread_local ContadoresHilo contadores_hilo_ = {};
+}
+
+ConteoInstrumentacion& ConteoInstrumentacion::operator+=(const ConteoInstrumentacion& otro) {
+    for (int k = 0; k < NUM_INSTRUMENTOS; ++k) valores[k] += otro.valores[k];
+    return *this;
+}
+
+ConteoInstrumentacion ConteoInstrumentacion::operator-(const ConteoInstrumentacion& otro) const {
+    ConteoInstrumentacion diferencia;
+    for (int k = 0; k < NUM_INSTRUMENTOS; ++k) diferencia.valores[k] = valores[k] - otro.valores[k];
+    return diferencia;
+}
+
+void contarInstrumento(InstrumentoConteo instrumento, unsigned long long cantidad) {
+    contadores_hilo_.valores[instrumento] += cantidad;
+}
+
+ConteoInstrumentacion leerInstrumentacion() {
+    ConteoInstrumentacion conteo;
+    for (int k = 0; k < NUM_INSTRUMENTOS; ++k) {
+        conteo.valores[k] = totales_[k].load(std::memory_order_relaxed) + contadores_hilo_.valores[k];
+    }
+    return conteo;
+}
+
+std::string textoInstrumentacion(const ConteoInstrumentacion& conteo) {
+    if (!INSTRUMENTACION_ACTIVA) return "";
+    std::string texto;
+    for (int k = 0; k < NUM_INSTRUMENTOS; ++k) {
+        if (k > 0) texto += ", ";
+        texto += std::string(NOMBRES_INSTRUMENTOS[k]) + ": " + std::to_string(conteo.valores[k]);
+    }
+    return texto;
+}
+
+#ifdef INSTRUMENTAR
+// --- Reemplazo de operator new/delete globales (solo en la compilación instrumentada) ---
+// Las variantes de tamaño y nothrow de delete que no se definen aquí llaman a estas.
+
+namespace {
+    void* reservar_(std::size_t bytes) {
+        contarInstrumento(INSTRUMENTO_RESERVAS);
+        contarInstrumento(INSTRUMENTO_BYTES, bytes);
+        return std::malloc(bytes == 0 ? 1 : bytes);
+    }
+
+    void liberar_(void* puntero) {
+        if (!puntero) return;
+        contarInstrumento(INSTRUMENTO_LIBERACIONES);
+        std::free(puntero);
+    }
+}
+
+void* operator new(std::size_t bytes) {
+    void* puntero = reservar_(bytes);
+    if (!puntero) throw std::bad_alloc();
+    return puntero;
+}
+
+void* operator new[](std::size_t bytes) {
+    void* puntero = reservar_(bytes);
+    if (!puntero) throw std::bad_alloc();
+    return puntero;
+}
+
+void* operator new(std::size_t bytes, const std::nothrow_t&) noexcept { return reservar_(bytes); }
+void* operator new[](std::size_t bytes, const std::nothrow_t&) noexcept { return reservar_(bytes); }
+
+void operator delete(void* puntero) noexcept { liberar_(puntero); }
+void operator delete[](void* puntero) noexcept { liberar_(puntero); }
+void operator delete(void* puntero, std::size_t) noexcept { liberar_(puntero); }
+void operator delete[](void* puntero, std::size_t) noexcept { liberar_(puntero); }
+#endif
@@ -0,0 +1,74 @@
+#ifndef INSTRUMENTACION_H
+#define INSTRUMENTACION_H
+
+#include <string>
+
+/**
+ * Conteo de copias, movimientos y reservas de memoria (compilación instrumentada).
+ *
+ * POR QUÉ: El RSS que mide el Monitor no dice por qué una variante por valor es lenta;
+ *          hacen falta las copias de Persona y las reservas de memoria que hace cada
+ *          operación.
+ * CÓMO: Con -DINSTRUMENTAR (make INSTRUMENTAR=1) Persona lleva un miembro vacío
+ *       InstrumentoCopias cuyos constructores y asignaciones de copia y movimiento
+ *       cuentan, y instrumentacion.cpp reemplaza operator new/delete globales. Cada hilo
+ *       cuenta en variables thread_local, sin sincronización; al terminar el hilo sus
+ *       cuentas se suman a unos totales atómicos. Sin la macro no se cuenta nada y
+ *       Persona no cambia.
+ * PARA QUÉ: Que el Monitor registre copias, movimientos, reservas y bytes por operación.
+ */
+
+// Métricas que se cuentan, en el orden de NOMBRES_INSTRUMENTOS
+enum InstrumentoConteo {
+    INSTRUMENTO_COPIAS,       // Copias de Persona (constructor y asignación)
+    INSTRUMENTO_MOVIMIENTOS,  // Movimientos de Persona (constructor y asignación)
+    INSTRUMENTO_RESERVAS,     // Llamadas a operator new / new[]
+    INSTRUMENTO_BYTES,        // Bytes pedidos a operator new / new[]
+    INSTRUMENTO_LIBERACIONES, // Llamadas a operator delete / delete[] con puntero no nulo
+    NUM_INSTRUMENTOS
+};
+
+extern const char* const NOMBRES_INSTRUMENTOS[NUM_INSTRUMENTOS];
+
+#ifdef INSTRUMENTAR
+const bool INSTRUMENTACION_ACTIVA = true;
+#else
+const bool INSTRUMENTACION_ACTIVA = false;
+#endif
+
+// Cuentas acumuladas de todas las métricas
+struct ConteoInstrumentacion {
+    unsigned long long valores[NUM_INSTRUMENTOS];
+
+    ConteoInstrumentacion() : valores() {}
+    ConteoInstrumentacion& operator+=(const ConteoInstrumentacion& otro);
+    ConteoInstrumentacion operator-(const ConteoInstrumentacion& otro) const;
+};
+
+// Suma un evento en el hilo actual
+void contarInstrumento(InstrumentoConteo instrumento, unsigned long long cantidad = 1);
+
+// Totales de los hilos ya terminados más lo contado por el hilo actual
+ConteoInstrumentacion leerInstrumentacion();
+
+// "Copias: 10, Movimientos: 2, ..." o "" sin instrumentación
+std::string textoInstrumentacion(const ConteoInstrumentacion& conteo);
+
+/**
+ * Miembro vacío que cuenta las copias y movimientos del objeto que lo contiene.
+ *
+ * Como miembro (y no como constructores de Persona) conserva los constructores y
+ * asignaciones implícitos de Persona y deja los structs como agregados.
+ */
+struct InstrumentoCopias {
+    InstrumentoCopias() {}
+    InstrumentoCopias(const InstrumentoCopias&) { contarInstrumento(INSTRUMENTO_COPIAS); }
+    InstrumentoCopias(InstrumentoCopias&&) noexcept { contarInstrumento(INSTRUMENTO_MOVIMIENTOS); }
+    InstrumentoCopias& operator=(const InstrumentoCopias&) { contarInstrumento(INSTRUMENTO_COPIAS); return *this; }
+    InstrumentoCopias& operator=(InstrumentoCopias&&) noexcept {
+        contarInstrumento(INSTRUMENTO_MOVIMIENTOS);
+        return *this;
+    }
+};
+
+#endif // INSTRUMENTACION_H
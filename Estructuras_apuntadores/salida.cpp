@@ -0,0 +1,67 @@
+#include "salida.h"
+#include <cerrno>
+#include <cmath>   // std::floor, std::fabs
+#include <cstdio>  // std::snprintf
+#include <cstring> // std::strlen
+#include <unistd.h>
+
+namespace {
+    unsigned hilosListados = 1; // Secuencial hasta que el usuario pida salida en paralelo
+}
+
+unsigned hilosSalida() {
+    return hilosListados;
+}
+
+void fijarHilosSalida(unsigned hilos) {
+    hilosListados = hilos;
+}
+
+void BufferTexto::agregar(const char* texto) {
+    agregar(texto, std::strlen(texto));
+}
+
+void BufferTexto::agregarEntero(uint64_t valor) {
+    char digitos[20];
+    size_t n = 0;
+    do {
+        digitos[n++] = static_cast<char>('0' + valor % 10);
+        valor /= 10;
+    } while (valor > 0);
+    while (n > 0) datos.push_back(digitos[--n]);
+}
+
+void BufferTexto::agregarDecimal2(double valor) {
+    // Camino rápido: centavos = valor * 100 redondeado. La multiplicación tiene un error
+    // relativo de 2^-53; si la parte fraccionaria queda cerca de 0.5 el redondeo podría
+    // diferir del de printf (que usa el valor decimal exacto), y ahí se usa snprintf.
+    const double centavos = valor * 100.0;
+    const double piso = std::floor(centavos);
+    const double fraccion = centavos - piso;
+    const double tolerancia = std::fabs(centavos) * 1e-15 + 1e-9;
+    if (valor >= 0.0 && centavos < 9e15 && std::fabs(fraccion - 0.5) > tolerancia) {
+        const uint64_t entero = static_cast<uint64_t>(piso) + (fraccion > 0.5 ? 1 : 0);
+        agregarEntero(entero / 100);
+        const unsigned resto = static_cast<unsigned>(entero % 100);
+        datos.push_back('.');
+        datos.push_back(static_cast<char>('0' + resto / 10));
+        datos.push_back(static_cast<char>('0' + resto % 10));
+        return;
+    }
+    char texto[64];
+    int n = std::snprintf(texto, sizeof(texto), "%.2f", valor);
+    if (n > 0) agregar(texto, static_cast<size_t>(n) < sizeof(texto) ? static_cast<size_t>(n) : sizeof(texto) - 1);
+}
+
+bool escribirTodo(int fd, const char* datos, size_t n) {
+    while (n > 0) {
+        ssize_t escritos = write(fd, datos, n);
+        if (escritos < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        datos += escritos;
+        n -= static_cast<size_t>(escritos);
+    }
+    return true;
+}
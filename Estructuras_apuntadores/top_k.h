@@ -0,0 +1,67 @@
+#ifndef TOP_K_H
+#define TOP_K_H
+
+#include <algorithm> // std::push_heap, std::pop_heap, std::sort
+#include <cstddef>
+#include <vector>
+
+/**
+ * Las K mejores filas vistas en un recorrido, en un montículo acotado.
+ *
+ * POR QUÉ: "Las 100 personas con mayor patrimonio de cada ciudad" ordenando las 10M filas
+ *          cuesta O(n log n) y una copia de la colección, aunque solo se conserven 100 por
+ *          ciudad.
+ * CÓMO: Un montículo de a lo sumo K entradas cuya raíz es la peor de ellas. Una fila nueva
+ *       se compara con la raíz (casi siempre se descarta con esa comparación) y, si es
+ *       mejor, la reemplaza en O(log K). El orden es total: mayor valor y, con el mismo
+ *       valor, menor fila, así que las K mejores no dependen del orden en que llegan las
+ *       filas y combinar() los montículos de varios hilos da el mismo resultado que un
+ *       recorrido secuencial.
+ * PARA QUÉ: Top-K en un recorrido con memoria O(K) por montículo.
+ */
+class MonticuloTopK {
+public:
+    struct Entrada {
+        double valor;
+        size_t fila;
+    };
+
+    explicit MonticuloTopK(size_t k = 0) : k_(k) { entradas_.reserve(k); }
+
+    // true si 'a' va antes que 'b' en el resultado: mayor valor o, con el mismo valor, menor fila
+    static bool antes(const Entrada& a, const Entrada& b) {
+        return a.valor > b.valor || (a.valor == b.valor && a.fila < b.fila);
+    }
+
+    void agregar(double valor, size_t fila) {
+        if (entradas_.size() == k_) {
+            // Lleno: casi todas las filas se descartan con esta comparación
+            if (k_ == 0 || !antes(Entrada{valor, fila}, entradas_.front())) return;
+            std::pop_heap(entradas_.begin(), entradas_.end(), antes);
+            entradas_.back() = Entrada{valor, fila};
+        } else {
+            entradas_.push_back(Entrada{valor, fila});
+        }
+        std::push_heap(entradas_.begin(), entradas_.end(), antes);
+    }
+
+    // Agrega las entradas de otro montículo (p. ej. el de otro hilo)
+    void combinar(const MonticuloTopK& otro) {
+        for (const Entrada& e : otro.entradas_) agregar(e.valor, e.fila);
+    }
+
+    size_t size() const { return entradas_.size(); }
+
+    // Las entradas de la mejor a la peor
+    std::vector<Entrada> ordenadas() const {
+        std::vector<Entrada> resultado(entradas_);
+        std::sort(resultado.begin(), resultado.end(), antes);
+        return resultado;
+    }
+
+private:
+    size_t k_;
+    std::vector<Entrada> entradas_; // Montículo: front() es la peor de las guardadas
+};
+
+#endif // TOP_K_H
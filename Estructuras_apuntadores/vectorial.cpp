@@ -0,0 +1,451 @@
+#include "vectorial.h"
+#include <cstring> // std::memcpy
+#include <iostream>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define VECTORIAL_X86 1
+#endif
+
+namespace {
+    // (c0 + c1) + (c2 + c3): el mismo orden en todas las versiones
+    double combinarCarriles(const double carriles[4]) {
+        return (carriles[0] + carriles[1]) + (carriles[2] + carriles[3]);
+    }
+
+    // Entre los mejores de cada carril, el de mayor valor (o menor, si 'menor') y, a igual valor, menor posición
+    size_t mejorCarril(const double valor[4], const double posicion[4], bool menor) {
+        size_t mejor = 0;
+        for (size_t j = 1; j < 4; ++j) {
+            bool gana = menor ? valor[j] < valor[mejor] : valor[j] > valor[mejor];
+            if (gana || (valor[j] == valor[mejor] && posicion[j] < posicion[mejor])) mejor = j;
+        }
+        return mejor;
+    }
+
+    // --- Versión escalar (referencia) ---
+
+    size_t posicionMaximaEscalar(const double* v, size_t n) {
+        if (n == 0) return n;
+        size_t mejor = 0;
+        for (size_t i = 1; i < n; ++i) {
+            if (v[i] > v[mejor]) mejor = i;
+        }
+        return mejor;
+    }
+
+    size_t posicionMinimaEscalar(const double* v, size_t n) {
+        if (n == 0) return n;
+        size_t mejor = 0;
+        for (size_t i = 1; i < n; ++i) {
+            if (v[i] < v[mejor]) mejor = i;
+        }
+        return mejor;
+    }
+
+    double sumaEscalar(const double* v, size_t n) {
+        double carriles[4] = {0.0, 0.0, 0.0, 0.0};
+        for (size_t i = 0; i < n; ++i) carriles[i & 3] += v[i];
+        return combinarCarriles(carriles);
+    }
+
+    double sumaEnmascaradaEscalar(const double* v, const uint8_t* claves, uint8_t clave, size_t n) {
+        double carriles[4] = {0.0, 0.0, 0.0, 0.0};
+        // Se suma 0.0 en las posiciones descartadas, igual que el AND de las versiones vectoriales
+        for (size_t i = 0; i < n; ++i) carriles[i & 3] += claves[i] == clave ? v[i] : 0.0;
+        return combinarCarriles(carriles);
+    }
+
+    size_t contarMayoresQueEscalar(const double* v, size_t n, double umbral) {
+        size_t conteo = 0;
+        for (size_t i = 0; i < n; ++i) conteo += v[i] > umbral;
+        return conteo;
+    }
+
+    size_t contarBitsEscalar(const uint64_t* p, size_t n) {
+        size_t conteo = 0;
+        for (size_t i = 0; i < n; ++i) conteo += __builtin_popcountll(p[i]);
+        return conteo;
+    }
+
+#ifdef VECTORIAL_X86
+    // --- SSE2: dos registros de 2 doubles forman los 4 carriles ---
+
+    // Extiende 4 bytes de comparación (0x00/0xFF) a dos máscaras de 2 doubles
+    __attribute__((target("sse2")))
+    void mascarasSSE2(const uint8_t* claves, __m128i clave, __m128d& bajo, __m128d& alto) {
+        int bytes;
+        std::memcpy(&bytes, claves, sizeof(bytes));
+        __m128i m = _mm_cmpeq_epi8(_mm_cvtsi32_si128(bytes), clave);
+        m = _mm_unpacklo_epi8(m, m);   // 16 bits por elemento
+        m = _mm_unpacklo_epi16(m, m);  // 32 bits por elemento
+        bajo = _mm_castsi128_pd(_mm_unpacklo_epi32(m, m));
+        alto = _mm_castsi128_pd(_mm_unpackhi_epi32(m, m));
+    }
+
+    __attribute__((target("sse2")))
+    size_t posicionExtremaSSE2(const double* v, size_t n, bool menor) {
+        if (n < 4) return menor ? posicionMinimaEscalar(v, n) : posicionMaximaEscalar(v, n);
+
+        __m128d mejorBajo = _mm_loadu_pd(v), mejorAlto = _mm_loadu_pd(v + 2);
+        __m128d posBajo = _mm_set_pd(1.0, 0.0), posAlto = _mm_set_pd(3.0, 2.0);
+        __m128d actualBajo = posBajo, actualAlto = posAlto;
+        const __m128d cuatro = _mm_set1_pd(4.0);
+
+        size_t i = 4;
+        for (; i + 4 <= n; i += 4) {
+            actualBajo = _mm_add_pd(actualBajo, cuatro);
+            actualAlto = _mm_add_pd(actualAlto, cuatro);
+            __m128d xBajo = _mm_loadu_pd(v + i), xAlto = _mm_loadu_pd(v + i + 2);
+            __m128d ganaBajo = menor ? _mm_cmplt_pd(xBajo, mejorBajo) : _mm_cmpgt_pd(xBajo, mejorBajo);
+            __m128d ganaAlto = menor ? _mm_cmplt_pd(xAlto, mejorAlto) : _mm_cmpgt_pd(xAlto, mejorAlto);
+            mejorBajo = _mm_or_pd(_mm_and_pd(ganaBajo, xBajo), _mm_andnot_pd(ganaBajo, mejorBajo));
+            mejorAlto = _mm_or_pd(_mm_and_pd(ganaAlto, xAlto), _mm_andnot_pd(ganaAlto, mejorAlto));
+            posBajo = _mm_or_pd(_mm_and_pd(ganaBajo, actualBajo), _mm_andnot_pd(ganaBajo, posBajo));
+            posAlto = _mm_or_pd(_mm_and_pd(ganaAlto, actualAlto), _mm_andnot_pd(ganaAlto, posAlto));
+        }
+
+        double valor[4], posicion[4];
+        _mm_storeu_pd(valor, mejorBajo);
+        _mm_storeu_pd(valor + 2, mejorAlto);
+        _mm_storeu_pd(posicion, posBajo);
+        _mm_storeu_pd(posicion + 2, posAlto);
+        size_t mejor = static_cast<size_t>(posicion[mejorCarril(valor, posicion, menor)]);
+
+        // Cola: posiciones posteriores, solo reemplazan con un valor estrictamente mejor
+        for (; i < n; ++i) {
+            if (menor ? v[i] < v[mejor] : v[i] > v[mejor]) mejor = i;
+        }
+        return mejor;
+    }
+
+    __attribute__((target("sse2")))
+    double sumaSSE2(const double* v, size_t n) {
+        __m128d bajo = _mm_setzero_pd(), alto = _mm_setzero_pd();
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            bajo = _mm_add_pd(bajo, _mm_loadu_pd(v + i));
+            alto = _mm_add_pd(alto, _mm_loadu_pd(v + i + 2));
+        }
+        double carriles[4];
+        _mm_storeu_pd(carriles, bajo);
+        _mm_storeu_pd(carriles + 2, alto);
+        for (; i < n; ++i) carriles[i & 3] += v[i];
+        return combinarCarriles(carriles);
+    }
+
+    __attribute__((target("sse2")))
+    double sumaEnmascaradaSSE2(const double* v, const uint8_t* claves, uint8_t clave, size_t n) {
+        const __m128i claveRepetida = _mm_set1_epi8(static_cast<char>(clave));
+        __m128d bajo = _mm_setzero_pd(), alto = _mm_setzero_pd();
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            __m128d mascaraBajo, mascaraAlto;
+            mascarasSSE2(claves + i, claveRepetida, mascaraBajo, mascaraAlto);
+            bajo = _mm_add_pd(bajo, _mm_and_pd(mascaraBajo, _mm_loadu_pd(v + i)));
+            alto = _mm_add_pd(alto, _mm_and_pd(mascaraAlto, _mm_loadu_pd(v + i + 2)));
+        }
+        double carriles[4];
+        _mm_storeu_pd(carriles, bajo);
+        _mm_storeu_pd(carriles + 2, alto);
+        for (; i < n; ++i) carriles[i & 3] += claves[i] == clave ? v[i] : 0.0;
+        return combinarCarriles(carriles);
+    }
+
+    __attribute__((target("sse2")))
+    size_t contarMayoresQueSSE2(const double* v, size_t n, double umbral) {
+        const __m128d u = _mm_set1_pd(umbral);
+        size_t conteo = 0;
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            int bits = _mm_movemask_pd(_mm_cmpgt_pd(_mm_loadu_pd(v + i), u))
+                     | (_mm_movemask_pd(_mm_cmpgt_pd(_mm_loadu_pd(v + i + 2), u)) << 2);
+            conteo += __builtin_popcount(bits);
+        }
+        for (; i < n; ++i) conteo += v[i] > umbral;
+        return conteo;
+    }
+
+    // Popcount SWAR por bytes (sumas de 1, 2 y 4 bits) y suma horizontal con psadbw
+    __attribute__((target("sse2")))
+    size_t contarBitsSSE2(const uint64_t* p, size_t n) {
+        const __m128i m1 = _mm_set1_epi8(0x55), m2 = _mm_set1_epi8(0x33), m4 = _mm_set1_epi8(0x0f);
+        __m128i total = _mm_setzero_si128();
+        size_t i = 0;
+        for (; i + 2 <= n; i += 2) {
+            __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+            x = _mm_sub_epi8(x, _mm_and_si128(_mm_srli_epi64(x, 1), m1));
+            x = _mm_add_epi8(_mm_and_si128(x, m2), _mm_and_si128(_mm_srli_epi64(x, 2), m2));
+            x = _mm_and_si128(_mm_add_epi8(x, _mm_srli_epi64(x, 4)), m4);
+            total = _mm_add_epi64(total, _mm_sad_epu8(x, _mm_setzero_si128()));
+        }
+        uint64_t partes[2];
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(partes), total);
+        size_t conteo = static_cast<size_t>(partes[0] + partes[1]);
+        for (; i < n; ++i) conteo += __builtin_popcountll(p[i]);
+        return conteo;
+    }
+
+    // --- AVX2: un registro de 4 doubles son los 4 carriles ---
+
+    __attribute__((target("avx2")))
+    size_t posicionExtremaAVX2(const double* v, size_t n, bool menor) {
+        if (n < 4) return menor ? posicionMinimaEscalar(v, n) : posicionMaximaEscalar(v, n);
+
+        __m256d mejor = _mm256_loadu_pd(v);
+        __m256d pos = _mm256_set_pd(3.0, 2.0, 1.0, 0.0);
+        __m256d actual = pos;
+        const __m256d cuatro = _mm256_set1_pd(4.0);
+
+        size_t i = 4;
+        for (; i + 4 <= n; i += 4) {
+            actual = _mm256_add_pd(actual, cuatro);
+            __m256d x = _mm256_loadu_pd(v + i);
+            __m256d gana = menor ? _mm256_cmp_pd(x, mejor, _CMP_LT_OQ) : _mm256_cmp_pd(x, mejor, _CMP_GT_OQ);
+            mejor = _mm256_blendv_pd(mejor, x, gana);
+            pos = _mm256_blendv_pd(pos, actual, gana);
+        }
+
+        double valor[4], posicion[4];
+        _mm256_storeu_pd(valor, mejor);
+        _mm256_storeu_pd(posicion, pos);
+        size_t m = static_cast<size_t>(posicion[mejorCarril(valor, posicion, menor)]);
+
+        for (; i < n; ++i) {
+            if (menor ? v[i] < v[m] : v[i] > v[m]) m = i;
+        }
+        return m;
+    }
+
+    __attribute__((target("avx2")))
+    double sumaAVX2(const double* v, size_t n) {
+        __m256d acumulado = _mm256_setzero_pd();
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4) acumulado = _mm256_add_pd(acumulado, _mm256_loadu_pd(v + i));
+        double carriles[4];
+        _mm256_storeu_pd(carriles, acumulado);
+        for (; i < n; ++i) carriles[i & 3] += v[i];
+        return combinarCarriles(carriles);
+    }
+
+    __attribute__((target("avx2")))
+    double sumaEnmascaradaAVX2(const double* v, const uint8_t* claves, uint8_t clave, size_t n) {
+        const __m128i claveRepetida = _mm_set1_epi8(static_cast<char>(clave));
+        __m256d acumulado = _mm256_setzero_pd();
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            int bytes;
+            std::memcpy(&bytes, claves + i, sizeof(bytes));
+            // 0xFF por byte igual, extendido con signo a 64 bits (todo unos)
+            __m128i iguales = _mm_cmpeq_epi8(_mm_cvtsi32_si128(bytes), claveRepetida);
+            __m256d mascara = _mm256_castsi256_pd(_mm256_cvtepi8_epi64(iguales));
+            acumulado = _mm256_add_pd(acumulado, _mm256_and_pd(mascara, _mm256_loadu_pd(v + i)));
+        }
+        double carriles[4];
+        _mm256_storeu_pd(carriles, acumulado);
+        for (; i < n; ++i) carriles[i & 3] += claves[i] == clave ? v[i] : 0.0;
+        return combinarCarriles(carriles);
+    }
+
+    __attribute__((target("avx2")))
+    size_t contarMayoresQueAVX2(const double* v, size_t n, double umbral) {
+        const __m256d u = _mm256_set1_pd(umbral);
+        size_t conteo = 0;
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            conteo += __builtin_popcount(_mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd(v + i), u, _CMP_GT_OQ)));
+        }
+        for (; i < n; ++i) conteo += v[i] > umbral;
+        return conteo;
+    }
+
+    // Popcount con tabla de 16 entradas por nibble (vpshufb) y suma horizontal con vpsadbw
+    __attribute__((target("avx2")))
+    size_t contarBitsAVX2(const uint64_t* p, size_t n) {
+        const __m256i tabla = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                               0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+        const __m256i m4 = _mm256_set1_epi8(0x0f);
+        __m256i total = _mm256_setzero_si256();
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+            const __m256i bajos = _mm256_shuffle_epi8(tabla, _mm256_and_si256(x, m4));
+            const __m256i altos = _mm256_shuffle_epi8(tabla, _mm256_and_si256(_mm256_srli_epi16(x, 4), m4));
+            total = _mm256_add_epi64(total, _mm256_sad_epu8(_mm256_add_epi8(bajos, altos), _mm256_setzero_si256()));
+        }
+        uint64_t partes[4];
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(partes), total);
+        size_t conteo = static_cast<size_t>((partes[0] + partes[1]) + (partes[2] + partes[3]));
+        for (; i < n; ++i) conteo += __builtin_popcountll(p[i]);
+        return conteo;
+    }
+#endif // VECTORIAL_X86
+
+    // Mejor nivel que soporta la CPU
+    NivelSimd nivelDisponible() {
+#ifdef VECTORIAL_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) return NivelSimd::AVX2;
+        if (__builtin_cpu_supports("sse2")) return NivelSimd::SSE2;
+#endif
+        return NivelSimd::Escalar;
+    }
+
+    // --- Núcleos de un nivel concreto (sin pasar por el nivel activo) ---
+
+    size_t posicionMaximaEn(NivelSimd nivel, const double* v, size_t n) {
+#ifdef VECTORIAL_X86
+        if (nivel == NivelSimd::AVX2) return posicionExtremaAVX2(v, n, false);
+        if (nivel == NivelSimd::SSE2) return posicionExtremaSSE2(v, n, false);
+#endif
+        (void)nivel;
+        return posicionMaximaEscalar(v, n);
+    }
+
+    size_t posicionMinimaEn(NivelSimd nivel, const double* v, size_t n) {
+#ifdef VECTORIAL_X86
+        if (nivel == NivelSimd::AVX2) return posicionExtremaAVX2(v, n, true);
+        if (nivel == NivelSimd::SSE2) return posicionExtremaSSE2(v, n, true);
+#endif
+        (void)nivel;
+        return posicionMinimaEscalar(v, n);
+    }
+
+    double sumaEn(NivelSimd nivel, const double* v, size_t n) {
+#ifdef VECTORIAL_X86
+        if (nivel == NivelSimd::AVX2) return sumaAVX2(v, n);
+        if (nivel == NivelSimd::SSE2) return sumaSSE2(v, n);
+#endif
+        (void)nivel;
+        return sumaEscalar(v, n);
+    }
+
+    double sumaEnmascaradaEn(NivelSimd nivel, const double* v, const uint8_t* claves, uint8_t clave, size_t n) {
+#ifdef VECTORIAL_X86
+        if (nivel == NivelSimd::AVX2) return sumaEnmascaradaAVX2(v, claves, clave, n);
+        if (nivel == NivelSimd::SSE2) return sumaEnmascaradaSSE2(v, claves, clave, n);
+#endif
+        (void)nivel;
+        return sumaEnmascaradaEscalar(v, claves, clave, n);
+    }
+
+    size_t contarMayoresQueEn(NivelSimd nivel, const double* v, size_t n, double umbral) {
+#ifdef VECTORIAL_X86
+        if (nivel == NivelSimd::AVX2) return contarMayoresQueAVX2(v, n, umbral);
+        if (nivel == NivelSimd::SSE2) return contarMayoresQueSSE2(v, n, umbral);
+#endif
+        (void)nivel;
+        return contarMayoresQueEscalar(v, n, umbral);
+    }
+
+    size_t contarBitsEn(NivelSimd nivel, const uint64_t* p, size_t n) {
+#ifdef VECTORIAL_X86
+        if (nivel == NivelSimd::AVX2) return contarBitsAVX2(p, n);
+        if (nivel == NivelSimd::SSE2) return contarBitsSSE2(p, n);
+#endif
+        (void)nivel;
+        return contarBitsEscalar(p, n);
+    }
+
+    /**
+     * Compara todos los núcleos de 'nivel' con la versión escalar.
+     *
+     * CÓMO: Datos con muchos empates (el máximo y el mínimo se repiten en varios carriles),
+     *       negativos, todas las longitudes de 0 a 67 y una larga, y un inicio desalineado.
+     */
+    bool coincideConEscalar(NivelSimd nivel) {
+        const size_t N = 1031;
+        std::vector<double> valores(N + 1);
+        std::vector<uint8_t> claves(N + 1);
+        std::vector<uint64_t> palabras(N + 1);
+        for (size_t i = 0; i <= N; ++i) {
+            valores[i] = static_cast<double>((i * 7919) % 97) * 1.25 - 40.0 + (i % 13 == 0 ? 0.1 : 0.0);
+            claves[i] = static_cast<uint8_t>((i * 31) % 5);
+            palabras[i] = (i % 7 == 0) ? ~uint64_t(0) : (uint64_t(i) * 0x9E3779B97F4A7C15ULL) >> (i % 11);
+        }
+
+        for (size_t inicio = 0; inicio <= 1; ++inicio) {
+            for (size_t n = 0; n + inicio <= N; n = (n < 67 ? n + 1 : N - inicio)) {
+                const double* v = valores.data() + inicio;
+                const uint8_t* k = claves.data() + inicio;
+                if (posicionMaximaEn(nivel, v, n) != posicionMaximaEscalar(v, n)) return false;
+                if (posicionMinimaEn(nivel, v, n) != posicionMinimaEscalar(v, n)) return false;
+                if (sumaEn(nivel, v, n) != sumaEscalar(v, n)) return false;
+                if (contarMayoresQueEn(nivel, v, n, 20.0) != contarMayoresQueEscalar(v, n, 20.0)) return false;
+                const uint64_t* w = palabras.data() + inicio;
+                if (contarBitsEn(nivel, w, n) != contarBitsEscalar(w, n)) return false;
+                for (uint8_t clave = 0; clave < 5; ++clave) {
+                    if (sumaEnmascaradaEn(nivel, v, k, clave, n) != sumaEnmascaradaEscalar(v, k, clave, n)) return false;
+                }
+                if (n == N - inicio) break;
+            }
+        }
+        return true;
+    }
+
+    // Nivel disponible más alto que coincide con la versión escalar
+    NivelSimd nivelVerificado(NivelSimd nivel) {
+        while (nivel != NivelSimd::Escalar && !coincideConEscalar(nivel)) {
+            std::cerr << "[vectorial] " << nombreNivelSimd(nivel) << " no coincide con la versión escalar; se descarta\n";
+            nivel = nivel == NivelSimd::AVX2 ? NivelSimd::SSE2 : NivelSimd::Escalar;
+        }
+        return nivel;
+    }
+
+    NivelSimd& nivelActual() {
+        static NivelSimd nivel = nivelVerificado(nivelDisponible());
+        return nivel;
+    }
+}
+
+NivelSimd nivelSimdActivo() {
+    return nivelActual();
+}
+
+void fijarNivelSimd(NivelSimd nivel) {
+    if (static_cast<int>(nivel) > static_cast<int>(nivelDisponible())) nivel = nivelDisponible();
+    nivelActual() = nivelVerificado(nivel);
+}
+
+const char* nombreNivelSimd(NivelSimd nivel) {
+    switch (nivel) {
+        case NivelSimd::AVX2: return "AVX2";
+        case NivelSimd::SSE2: return "SSE2";
+        default:              return "escalar";
+    }
+}
+
+size_t posicionMaxima(const double* valores, size_t n) {
+    return posicionMaximaEn(nivelActual(), valores, n);
+}
+
+size_t posicionMinima(const double* valores, size_t n) {
+    return posicionMinimaEn(nivelActual(), valores, n);
+}
+
+double sumaVectorial(const double* valores, size_t n) {
+    return sumaEn(nivelActual(), valores, n);
+}
+
+double sumaEnmascarada(const double* valores, const uint8_t* claves, uint8_t clave, size_t n) {
+    return sumaEnmascaradaEn(nivelActual(), valores, claves, clave, n);
+}
+
+size_t contarMayoresQue(const double* valores, size_t n, double umbral) {
+    return contarMayoresQueEn(nivelActual(), valores, n, umbral);
+}
+
+size_t contarBits(const uint64_t* palabras, size_t n) {
+    return contarBitsEn(nivelActual(), palabras, n);
+}
+
+bool verificarNucleosVectoriales() {
+    const NivelSimd disponible = nivelDisponible();
+    bool correcto = true;
+    for (NivelSimd nivel : {NivelSimd::SSE2, NivelSimd::AVX2}) {
+        if (static_cast<int>(nivel) > static_cast<int>(disponible)) break;
+        correcto = coincideConEscalar(nivel) && correcto;
+    }
+    return correcto;
+}
@@ -0,0 +1,62 @@
+#ifndef VECTORIAL_H
+#define VECTORIAL_H
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Núcleos vectoriales (SSE2/AVX2) para recorridos sobre columnas double y mapas de bits.
+ *
+ * POR QUÉ: Con las cifras financieras en arreglos contiguos, los recorridos de máximo,
+ *          suma y conteo están limitados por el ancho de banda de memoria solo si cada
+ *          ciclo procesa varios valores; el bucle escalar se queda muy por debajo.
+ * CÓMO: Cada núcleo tiene una versión escalar, una SSE2 y una AVX2, y todas recorren
+ *       el arreglo en el mismo orden de 4 carriles: el carril j acumula las posiciones
+ *       i con i % 4 == j, y al final se combina (c0 + c1) + (c2 + c3). Por eso las sumas
+ *       dan exactamente el mismo double en las tres versiones. El máximo y el mínimo
+ *       devuelven la primera posición que alcanza el valor, como std::max_element.
+ *       La versión se elige una vez en tiempo de ejecución según la CPU
+ *       (__builtin_cpu_supports) y se comprueba contra la escalar antes de usarla.
+ * PARA QUÉ: Consultas sobre millones de filas a la velocidad de la memoria, en
+ *           cualquier x86-64 y con un respaldo escalar en otras arquitecturas.
+ *
+ * Los valores no deben contener NaN.
+ */
+
+enum class NivelSimd { Escalar, SSE2, AVX2 };
+
+// Nivel en uso (se detecta y verifica en la primera llamada)
+NivelSimd nivelSimdActivo();
+
+// Fuerza un nivel (se limita al disponible en la CPU); útil para comparar versiones
+void fijarNivelSimd(NivelSimd nivel);
+
+const char* nombreNivelSimd(NivelSimd nivel);
+
+// Primera posición del mayor valor, o n si n == 0
+size_t posicionMaxima(const double* valores, size_t n);
+
+// Primera posición del menor valor, o n si n == 0
+size_t posicionMinima(const double* valores, size_t n);
+
+// Suma en el orden de 4 carriles
+double sumaVectorial(const double* valores, size_t n);
+
+// Suma de valores[i] con claves[i] == clave, en el orden de 4 carriles
+double sumaEnmascarada(const double* valores, const uint8_t* claves, uint8_t clave, size_t n);
+
+// Número de valores estrictamente mayores que 'umbral'
+size_t contarMayoresQue(const double* valores, size_t n, double umbral);
+
+// Número de bits en 1 de n palabras (popcount con tabla de nibbles en AVX2, SWAR en SSE2)
+size_t contarBits(const uint64_t* palabras, size_t n);
+
+/**
+ * Ejecuta todos los núcleos en todos los niveles disponibles sobre datos de prueba
+ * (con empates y longitudes que no son múltiplo de 4) y compara con la versión escalar.
+ *
+ * @return true si todos los niveles dan resultados idénticos.
+ */
+bool verificarNucleosVectoriales();
+
+#endif // VECTORIAL_H
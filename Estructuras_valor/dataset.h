@@ -0,0 +1,55 @@
+#ifndef DATASET_H
+#define DATASET_H
+
+#include "persona.h"
+#include <cstddef>
+#include <memory>
+#include <utility> // std::move
+#include <vector>
+
+/**
+ * Colección de personas con semántica de valor y almacenamiento compartido (copy-on-write).
+ *
+ * POR QUÉ: Las consultas de las variantes por valor reciben la colección por valor; con
+ *          std::vector<Persona> cada llamada copiaba los 10M registros (gigabytes de
+ *          reservas por consulta) aunque ninguna la modifica.
+ * CÓMO: Los registros viven en un std::vector<Persona> apuntado por un shared_ptr. Copiar
+ *       un Dataset copia el puntero (O(1)); la lectura es siempre const. Quien necesite
+ *       modificar llama a modificar(), que primero duplica el vector si otra copia lo
+ *       comparte, así ninguna copia ve los cambios de otra.
+ * PARA QUÉ: Conservar la API por valor (cada función tiene "su" colección) con un costo
+ *           de paso de parámetro independiente del número de personas.
+ */
+class Dataset {
+public:
+    typedef ColeccionPersonas::const_iterator const_iterator;
+
+    Dataset() : registros(std::make_shared<ColeccionPersonas>()) {}
+    // Implícito para que 'personas = generarColeccion(n)' siga funcionando; no copia el vector
+    Dataset(ColeccionPersonas personas)
+        : registros(std::make_shared<ColeccionPersonas>(std::move(personas))) {}
+
+    size_t size() const { return registros->size(); }
+    bool empty() const { return registros->empty(); }
+    const Persona& operator[](size_t i) const { return (*registros)[i]; }
+    const_iterator begin() const { return registros->begin(); }
+    const_iterator end() const { return registros->end(); }
+    const ColeccionPersonas& vector() const { return *registros; }
+
+    // Vector modificable de esta copia; lo duplica antes si otra copia lo comparte
+    ColeccionPersonas& modificar() {
+        if (registros.use_count() > 1) registros = std::make_shared<ColeccionPersonas>(*registros);
+        return *registros;
+    }
+
+    // Suelta esta referencia; la memoria se libera cuando la suelta la última copia
+    void clear() { registros = std::make_shared<ColeccionPersonas>(); }
+
+    // Número de copias que comparten los registros (1 = esta es la única)
+    long copiasCompartidas() const { return registros.use_count(); }
+
+private:
+    std::shared_ptr<ColeccionPersonas> registros; // Nunca nulo
+};
+
+#endif // DATASET_H
@@ -1,4 +1,6 @@
 #include "generador.h"
+#include "paralelo.h" // ejecutarEnBloques, reducirEnParalelo
+#include "salida.h"   // escribirRegistros, hilosSalida
 #include "persona.h"
 #include <cstdlib>   // rand(), srand()
 #include <ctime>     // time()
@@ -36,9 +38,50 @@ const std::vector<std::string> ciudadesColombia = {
     "Manizales", "Pasto", "Neiva", "Villavicencio", "Armenia", "Sincelejo", "Valledupar", "Montería", "Popayán", "Tunja"
 };
 
+// Todas las combinaciones "Apellido1 Apellido2"; el código es primero * N + segundo
+static std::vector<std::string> combinarApellidos() {
+    std::vector<std::string> compuestos;
+    compuestos.reserve(apellidos.size() * apellidos.size());
+    for (const std::string& primero : apellidos) {
+        for (const std::string& segundo : apellidos) {
+            compuestos.push_back(primero + " " + segundo);
+        }
+    }
+    return compuestos;
+}
+
+// Nombres femeninos seguidos de los masculinos
+static std::vector<std::string> combinarNombres() {
+    std::vector<std::string> nombres(nombresFemeninos);
+    nombres.insert(nombres.end(), nombresMasculinos.begin(), nombresMasculinos.end());
+    return nombres;
+}
+
+// Diccionarios globales, precargados con las tablas: el código de cada valor es su posición
+DiccionarioCadenas& diccionarioCiudades() {
+    static DiccionarioCadenas diccionario(ciudadesColombia);
+    return diccionario;
+}
+
+DiccionarioCadenas& diccionarioNombres() {
+    static DiccionarioCadenas diccionario(combinarNombres());
+    return diccionario;
+}
+
+DiccionarioCadenas& diccionarioApellidos() {
+    static DiccionarioCadenas diccionario(combinarApellidos());
+    return diccionario;
+}
+
+// Códigos de los valores de las tablas (mismo orden con el que se precargan los diccionarios)
+static CodigoCadena codigoNombreFemenino(size_t i) { return static_cast<CodigoCadena>(i); }
+static CodigoCadena codigoNombreMasculino(size_t i) { return static_cast<CodigoCadena>(nombresFemeninos.size() + i); }
+static CodigoCadena codigoApellido(size_t primero, size_t segundo) { return static_cast<CodigoCadena>(primero * apellidos.size() + segundo); }
+static CodigoCadena codigoCiudad(size_t i) { return static_cast<CodigoCadena>(i); }
+
 // Implementación de funciones generadoras
 
-std::string generarFechaNacimiento() {
+FechaAAAAMMDD generarFechaNacimiento() {
     // Genera día aleatorio (1-28 para simplificar)
     int dia = 1 + rand() % 28;
     // Mes aleatorio (1-12)
@@ -46,13 +89,22 @@ std::string generarFechaNacimiento() {
     // Año entre 1960-2010
     int anio = 1960 + rand() % 50;
     
-    // Convierte a string en formato DD/MM/AAAA
-    return std::to_string(dia) + "/" + std::to_string(mes) + "/" + std::to_string(anio);
+    // Empaqueta como entero AAAAMMDD (ordena igual que la fecha)
+    return componerFecha(dia, mes, anio);
 }
 
-std::string generarID() {
-    static long contador = 1000000000; // ID inicial
-    return std::to_string(contador++); // Incrementa después de usar
+FechaAAAAMMDD generarFechaNacimiento(GeneradorContador& gen) {
+    // Mismos rangos que la versión con rand(): día 1-28, mes 1-12, año 1960-2009
+    int dia = 1 + gen.enteroMenorQue(28);
+    int mes = 1 + gen.enteroMenorQue(12);
+    int anio = 1960 + gen.enteroMenorQue(50);
+
+    return componerFecha(dia, mes, anio);
+}
+
+uint64_t generarID() {
+    static uint64_t contador = 1000000000; // ID inicial
+    return contador++;                     // Incrementa después de usar
 }
 
 char grupoRenta(int id, bool declarante) {
@@ -87,19 +139,20 @@ Persona generarPersona() {
     // Decide si es hombre o mujer
     bool esHombre = rand() % 2;
     
-    // Selecciona nombre según género
+    // Selecciona nombre según género (solo su código en el diccionario)
     p.nombre = esHombre ? 
-        nombresMasculinos[rand() % nombresMasculinos.size()] :
-        nombresFemeninos[rand() % nombresFemeninos.size()];
+        codigoNombreMasculino(rand() % nombresMasculinos.size()) :
+        codigoNombreFemenino(rand() % nombresFemeninos.size());
     
     // Construye apellido compuesto (dos apellidos aleatorios)
-    p.apellido = apellidos[rand() % apellidos.size()] + " " +
-                 apellidos[rand() % apellidos.size()];
+    size_t primerApellido = rand() % apellidos.size();
+    size_t segundoApellido = rand() % apellidos.size();
+    p.apellido = codigoApellido(primerApellido, segundoApellido);
     
     // Genera los demás atributos
     p.id = generarID();
 
-    p.ciudadNacimiento = ciudadesColombia[rand() % ciudadesColombia.size()];
+    p.ciudadNacimiento = codigoCiudad(rand() % ciudadesColombia.size());
     p.fechaNacimiento = generarFechaNacimiento();
     
     // Genera datos financieros realistas
@@ -107,13 +160,13 @@ Persona generarPersona() {
     p.patrimonio = randomDouble(0, 2000000000);              // 0 a 2,000M COP
     p.deudas = randomDouble(0, p.patrimonio * 0.7);          // Deudas hasta el 70% del patrimonio
     p.declaranteRenta = (p.ingresosAnuales > 50000000) && (rand() % 100 > 30); // Probabilidad 70% si ingresos > 50M
-    p.grupoDeclaracion = grupoRenta(std::stol(p.id) % 100, p.declaranteRenta);
+    p.grupoDeclaracion = grupoRenta(p.id % 100, p.declaranteRenta);
     
     return p; // struct, por valor
 }
 
-std::vector<Persona> generarColeccion(int n) {
-    std::vector<Persona> personas;
+ColeccionPersonas generarColeccion(int n) {
+    ColeccionPersonas personas;
     // Reserva espacio para n personas (optimización)
     personas.reserve(n);
     
@@ -125,17 +178,132 @@ std::vector<Persona> generarColeccion(int n) {
     return personas;
 }
 
-Persona buscarPorID(std::vector<Persona> personas, std::string id) {
-    auto it = std::lower_bound(personas.begin(), personas.end(), id, 
-        [](const Persona& p, const std::string& id) {
-            return p.id < id;  // Acceso directo al atributo público
+/**
+ * Implementación de generarPersona determinista para struct.
+ *
+ * POR QUÉ: generarPersona() usa rand() y un mt19937 estático, que no se pueden compartir entre hilos.
+ * CÓMO: Mismas reglas de generación, tomando cada valor de un GeneradorContador con clave (semilla, indice).
+ * PARA QUÉ: Que la persona i sea siempre la misma sin importar qué hilo la genere.
+ */
+Persona generarPersona(uint64_t semilla, uint64_t indice) {
+    GeneradorContador gen(semilla, indice);
+    Persona p;
+
+    // Decide si es hombre o mujer
+    bool esHombre = gen.enteroMenorQue(2);
+
+    // Selecciona nombre según género (solo su código en el diccionario)
+    p.nombre = esHombre ?
+        codigoNombreMasculino(gen.enteroMenorQue(nombresMasculinos.size())) :
+        codigoNombreFemenino(gen.enteroMenorQue(nombresFemeninos.size()));
+
+    // Combina dos apellidos aleatorios
+    size_t primerApellido = gen.enteroMenorQue(apellidos.size());
+    size_t segundoApellido = gen.enteroMenorQue(apellidos.size());
+    p.apellido = codigoApellido(primerApellido, segundoApellido);
+
+    // El ID depende solo de la posición en el conjunto
+    uint64_t id = 1000000000ULL + indice;
+    p.id = id;
+
+    p.ciudadNacimiento = codigoCiudad(gen.enteroMenorQue(ciudadesColombia.size()));
+    p.fechaNacimiento = generarFechaNacimiento(gen);
+
+    // Datos económicos con los mismos rangos que generarPersona()
+    p.ingresosAnuales = gen.uniforme(10000000, 500000000);
+    p.patrimonio = gen.uniforme(0, 2000000000);
+    p.deudas = gen.uniforme(0, p.patrimonio * 0.7);
+    p.declaranteRenta = (p.ingresosAnuales > 50000000) && (gen.enteroMenorQue(100) > 30);
+    p.grupoDeclaracion = grupoRenta(id % 100, p.declaranteRenta);
+
+    return p;
+}
+
+/**
+ * Implementación de generarColeccionParalela.
+ *
+ * POR QUÉ: La generación secuencial usa un solo núcleo.
+ * CÓMO: El vector se dimensiona de una vez y cada hilo escribe su bloque contiguo
+ *       [inicio, fin) con generarPersona(semilla, i); no hay estado compartido.
+ * PARA QUÉ: Crear 10M personas en paralelo con resultado reproducible.
+ */
+ColeccionPersonas generarColeccionParalela(int n, uint64_t semilla, unsigned hilos) {
+    if (n <= 0) return ColeccionPersonas();
+
+    ColeccionPersonas personas(n);
+
+    ejecutarEnBloques(personas.size(), hilos,
+        [&personas, semilla](size_t inicio, size_t fin, unsigned) {
+            for (size_t i = inicio; i < fin; ++i) {
+                personas[i] = generarPersona(semilla, i);
+            }
         });
 
-    if (it != personas.end() && it->id == id) {
-        return *it;  // Retorna copia de la persona encontrada
-    } else {
-        return generarPersonaVacia();  // Si no se encuentra, devuelve una persona vacía
+    return personas;
+}
+
+// Cada hilo agrega su tramo de índices en su propio AgregadoEnFlujo; los tramos se combinan
+// en orden, así que el resultado es el de las consultas sobre generarColeccionParalela(n, semilla)
+AgregadoEnFlujo generarYAgregar(uint64_t n, uint64_t semilla, unsigned hilos) {
+    return reducirEnParalelo(static_cast<size_t>(n), hilos, AgregadoEnFlujo(),
+        [semilla](size_t inicio, size_t fin, AgregadoEnFlujo& parcial) {
+            for (size_t i = inicio; i < fin; ++i) {
+                const Persona p = generarPersona(semilla, i);
+                parcial.agregar(p.id, p.nombre, p.apellido, p.ciudadNacimiento, p.grupoDeclaracion, p.patrimonio);
+            }
+        },
+        [](AgregadoEnFlujo& acumulado, const AgregadoEnFlujo& parcial) { acumulado.combinar(parcial); });
+}
+
+// Construye el almacén columnar: copia los códigos de diccionario y la fecha AAAAMMDD
+PersonaColumns construirColumnas(Dataset personas) {
+    PersonaColumns columnas;
+    columnas.reservar(personas.size());
+
+    for (const Persona& p : personas) {
+        columnas.id.push_back(p.id);
+        columnas.nombre.push_back(p.nombre);
+        columnas.apellido.push_back(p.apellido);
+        columnas.fechaNacimiento.push_back(p.fechaNacimiento);
+        columnas.ciudad.push_back(static_cast<uint8_t>(p.ciudadNacimiento));
+        columnas.ingresosAnuales.push_back(p.ingresosAnuales);
+        columnas.patrimonio.push_back(p.patrimonio);
+        columnas.deudas.push_back(p.deudas);
+        columnas.declaranteRenta.push_back(p.declaranteRenta ? 1 : 0);
+        columnas.grupoDeclaracion.push_back(p.grupoDeclaracion);
+    }
+    columnas.indexarIDs();
+    return columnas;
+}
+
+// Colección de personas a partir de las columnas (inversa de construirColumnas)
+ColeccionPersonas construirPersonas(const PersonaColumns& columnas) {
+    ColeccionPersonas personas;
+    personas.reserve(columnas.size());
+
+    for (size_t i = 0; i < columnas.size(); ++i) {
+        personas.push_back(Persona{columnas.nombre[i], columnas.apellido[i], columnas.id[i],
+                                   static_cast<CodigoCadena>(columnas.ciudad[i]), columnas.fechaNacimiento[i],
+                                   columnas.ingresosAnuales[i], columnas.patrimonio[i], columnas.deudas[i],
+                                   columnas.declaranteRenta[i] != 0, columnas.grupoDeclaracion[i]});
     }
+    return personas;
+}
+
+// Índice ID -> fila de la colección (ver indice_id.h)
+IndiceID construirIndiceID(Dataset personas) {
+    IndiceID indice;
+    indice.construir(personas.size(), [&personas](size_t i) { return personas[i].id; });
+    return indice;
+}
+
+// Fila por índice en O(1); se confirma el ID por si el índice quedó desactualizado
+Persona buscarPorID(Dataset personas, const IndiceID& indice, uint64_t id) {
+    size_t fila = indice.buscar(id);
+    if (fila < personas.size() && personas[fila].id == id) {
+        return personas[fila];  // Retorna copia de la persona encontrada
+    }
+    return generarPersonaVacia();  // Si no se encuentra, devuelve una persona vacía
 }
 /**
  * Genera una Persona "vacía" con valores por defecto para representar "no encontrado".
@@ -145,10 +313,11 @@ Persona buscarPorID(std::vector<Persona> personas, std::string id) {
  * PARA QUÉ: Evitar errores de compilación y mantener el enfoque por valor.
  */
 Persona generarPersonaVacia() {
-    return Persona{"", "", "", "", "", 0.0, 0.0, 0.0, false, 'N' };
+    // Códigos 0 para no agregar "" a los diccionarios; se reconoce por el ID 0
+    return Persona{0, 0, 0, 0, 0, 0.0, 0.0, 0.0, false, 'N' };
 }
 
-Persona buscarMayorPatrimonio(std::vector<Persona> personas) {
+Persona buscarMayorPatrimonio(Dataset personas) {
     // Si la lista está vacía, devolvemos un objeto Persona vacío
     if (personas.empty()) return generarPersonaVacia();
 
@@ -166,30 +335,32 @@ Persona buscarMayorPatrimonio(std::vector<Persona> personas) {
  * Imprime un listado de las personas con mayor patrimonio en cada ciudad.
  *
  * POR QUÉ: Encontrar a la persona con mayor patrimonio en cada ciudad de Colombia.
- * CÓMO: Usando un mapa temporal para guardar, por ciudad, la persona con
- *       mayor patrimonio encontrada (acceso directo a atributos públicos del struct).
+ * CÓMO: El código de ciudad indexa un arreglo con la persona de
+ *       mayor patrimonio encontrada hasta el momento (sin hash de strings).
  * PARA QUÉ: Listar y mostrar personas con mayor patrimonio por ciudad, usando struct y por valor.
  */
-void buscarMayoresPatrimonioPorCiudad(std::vector<Persona> personas) {
-    std::unordered_map<std::string, Persona> mayoresPorCiudad;
-    mayoresPorCiudad.reserve(personas.size());
-    // Recorremos todas las personas (acceso directo a atributos públicos)
-    for (const auto& p : personas) {
-        std::string ciudad = p.ciudadNacimiento;
+void buscarMayoresPatrimonioPorCiudad(Dataset personas) {
+    // Posición de la persona con mayor patrimonio de cada ciudad (indexado por código de ciudad)
+    const size_t sinPersona = personas.size();
+    std::vector<size_t> mayoresPorCiudad(diccionarioCiudades().size(), sinPersona);
 
-        auto it = mayoresPorCiudad.find(ciudad);
-        if (it == mayoresPorCiudad.end()) {
-            mayoresPorCiudad.insert({ciudad, p});
-        } else if (p.patrimonio > it->second.patrimonio) {
-            it->second = p;
+    // Recorremos todas las personas
+    for (size_t i = 0; i < personas.size(); ++i) {
+        size_t& mayor = mayoresPorCiudad[personas[i].ciudadNacimiento];
+        if (mayor == sinPersona || personas[i].patrimonio > personas[mayor].patrimonio) {
+            mayor = i;
         }
     }
+    // Configuramos el formato: fijo, con decimales (2) → se imprime como decimal
+    std::cout << std::fixed << std::setprecision(2);
     std::cout << "\n=== Personas con mayor patrimonio por ciudad ===\n";
-    for (const auto& par : mayoresPorCiudad) {
-        std::cout << "- " << par.first << ": "
-                  << par.second.nombre << " "
-                  << par.second.apellido << " ("
-                  << std::fixed << std::setprecision(2) << par.second.patrimonio << ")\n";
+    for (size_t c = 0; c < mayoresPorCiudad.size(); ++c) {
+        if (mayoresPorCiudad[c] == sinPersona) continue; // ciudad sin personas
+        Persona mayor = personas[mayoresPorCiudad[c]];   // copia de la persona
+        std::cout << "- " << diccionarioCiudades().texto(c) << ": "
+                  << mayor.textoNombre() << " "
+                  << mayor.textoApellido() << " ("
+                  << mayor.patrimonio << ")\n";
     }
 }
 
@@ -201,7 +372,7 @@ void buscarMayoresPatrimonioPorCiudad(std::vector<Persona> personas) {
  *       mayor patrimonio encontrada hasta el momento (acceso directo a atributos públicos del struct).
  * PARA QUÉ: Listar y mostrar personas con mayor patrimonio por grupo usando struct y por valor.
  */
-void buscarMayoresPatrimonioPorGrupo(std::vector<Persona> personas) {
+void buscarMayoresPatrimonioPorGrupo(Dataset personas) {
     // Mapa temporal que guarda, por cada grupo, la persona con mayor patrimonio
     std::unordered_map<char, Persona> mayoresPorGrupo;
     mayoresPorGrupo.reserve(personas.size()); // evita rehashes innecesarios
@@ -224,8 +395,8 @@ void buscarMayoresPatrimonioPorGrupo(std::vector<Persona> personas) {
     std::cout << "\n=== Personas con mayor patrimonio por grupo de declaración ===\n";
     for (const auto& par : mayoresPorGrupo) { 
         std::cout << "- " << par.first << ": "
-                  << par.second.nombre << " "
-                  << par.second.apellido << " ("
+                  << par.second.textoNombre() << " "
+                  << par.second.textoApellido() << " ("
                   << std::fixed << std::setprecision(2) << par.second.patrimonio << ")\n";
     }
 }
@@ -234,19 +405,19 @@ void buscarMayoresPatrimonioPorGrupo(std::vector<Persona> personas) {
  * Implementación de buscarPersonaMasLongevaConCondicion--
  * 
  * POR QUÉ: Encontrar la persona más longeva (con la fecha de nacimiento más antigua) en una colección de personas.
- * CÓMO: Recorriendo el vector de personas y comparando fechas de nacimiento; si se encuentra la fecha más antigua posible, termina la búsqueda anticipadamente.
+ * CÓMO: Recorriendo el vector de personas y comparando fechas de nacimiento como enteros AAAAMMDD (orden cronológico); si se encuentra la fecha más antigua posible, termina la búsqueda anticipadamente.
  * PARA QUÉ: Para obtener rápidamente la persona más longeva en el país, optimizando el tiempo si aparece la fecha mínima.
  * (Usa struct y acceso directo a atributos públicos, retorna por valor)
  */
-Persona buscarPersonaMasLongevaConCondicion(std::vector<Persona> personas) {
+Persona buscarPersonaMasLongevaConCondicion(Dataset personas) {
     if (personas.empty()) return generarPersonaVacia();
 
-    const std::string fechaObjetivo = "1/1/1960";  // fecha más antigua posible
+    const FechaAAAAMMDD fechaObjetivo = FECHA_MAS_ANTIGUA;  // fecha más antigua posible
     Persona masLongeva = personas[0];              // copia de la primera Persona
-    std::string fechaMasLongeva = masLongeva.fechaNacimiento;
+    FechaAAAAMMDD fechaMasLongeva = masLongeva.fechaNacimiento;
 
     for (size_t i = 1; i < personas.size(); ++i) {
-        const std::string fechaActual = personas[i].fechaNacimiento;
+        const FechaAAAAMMDD fechaActual = personas[i].fechaNacimiento;
         if (fechaActual < fechaMasLongeva) {
             masLongeva = personas[i];
             fechaMasLongeva = masLongeva.fechaNacimiento;
@@ -262,161 +433,128 @@ Persona buscarPersonaMasLongevaConCondicion(std::vector<Persona> personas) {
  * Implementación de mostrarPersonasMasLongevaPorCiudad_Vector adaptada para struct y por valor.
  * 
  * POR QUÉ: Mostrar la persona más longeva de cada ciudad en una colección de personas.
- * CÓMO: Recorriendo el vector de personas, agrupando por ciudad y comparando fechas de nacimiento para cada grupo.
+ * CÓMO: Recorriendo el vector de personas; el código de ciudad indexa la persona más longeva de cada ciudad.
  * PARA QUÉ: Para visualizar, por ciudad, quién es la persona más longeva, útil para estadísticas y reportes por región.
  */
-void mostrarPersonasMasLongevaPorCiudad_Vector(std::vector<Persona> personas) { //recibe por valor
-    std::vector<std::pair<std::string, Persona>> resultado; //lista dinamica de pares (ciudad, persona) por valor
-
-    for (auto persona : personas) {  //copia en cada iteración
-        std::string ciudad = persona.ciudadNacimiento; // acceso directo
-        auto iter = std::find_if(resultado.begin(), resultado.end(), //observa si ya hay un par con esa ciudad
-            [ciudad](const std::pair<std::string, Persona> par) {  //compara el par guardado con ciudad (de la iteración)
-                return par.first == ciudad;
-            });
-        if (iter == resultado.end()) { //si no está la ciudad, se agrega
-            resultado.push_back({ciudad, persona}); //copia de la persona
-        } else {  //si ya está,compara fechas con la persona(second) y actualiza si es necesario
-            if (persona.fechaNacimiento < iter->second.fechaNacimiento) { // acceso directo
-                iter->second = persona; //copia de la persona más longeva
-            }
+void mostrarPersonasMasLongevaPorCiudad_Vector(Dataset personas) { //recibe por valor
+    // Posición de la persona más longeva de cada ciudad (indexado por código de ciudad)
+    const size_t sinPersona = personas.size();
+    std::vector<size_t> resultado(diccionarioCiudades().size(), sinPersona);
+
+    for (size_t i = 0; i < personas.size(); ++i) {
+        size_t& masLongeva = resultado[personas[i].ciudadNacimiento];
+        if (masLongeva == sinPersona) { //si la ciudad no tenía persona, se asigna
+            masLongeva = i;
+        } else if (personas[i].fechaNacimiento < personas[masLongeva].fechaNacimiento) {
+            masLongeva = i; //si ya tenía, compara fechas y actualiza si es necesario
         }
     }
 
     std::cout << "\n=== Persona más longeva por ciudad ===\n";
-    for (auto par : resultado) {  //copia del par para mantener enfoque 100% por valor
-        std::cout << "- " << par.first << ": "
-                  << par.second.nombre << " "      // acceso directo
-                  << par.second.apellido << " ("   // acceso directo
-                  << par.second.fechaNacimiento << ")\n"; // acceso directo
+    for (size_t c = 0; c < resultado.size(); ++c) {
+        if (resultado[c] == sinPersona) continue;
+        Persona persona = personas[resultado[c]];  //copia de la persona para mantener enfoque por valor
+        std::cout << "- " << diccionarioCiudades().texto(c) << ": "
+                  << persona.textoNombre() << " "
+                  << persona.textoApellido() << " ("
+                  << persona.textoFecha() << ")\n";
     }
 }
 
-void listarPersonasGrupo(std::vector<Persona> personas, char grupoDeclaracion, int contador) {
+int listarPersonasGrupo(Dataset personas, char grupoDeclaracion, int contador) {
     // Recorremos todas las personas y contamos las que cumplen con la condición
     std::cout << "Persona del grupo " << grupoDeclaracion << " encontradas:" << std::endl;
-    for (Persona p : personas) {  // copia en cada iteración
-        if (p.grupoDeclaracion == grupoDeclaracion) { // acceso directo al atributo del struct
-            std::cout << p.id << " " << p.nombre << " " << p.patrimonio << std::endl; // acceso directo
-            ++contador;  
-        }
-    }
+    // Las líneas se formatean en búferes y se escriben por bloques (ver salida.h)
+    contador += static_cast<int>(escribirRegistros(personas.size(), hilosSalida(), [&](size_t i, BufferTexto& salida) {
+        const Persona& p = personas[i];
+        if (p.grupoDeclaracion != grupoDeclaracion) return false; // acceso directo al atributo del struct
+        salida.agregarEntero(p.id);
+        salida.agregar(' ');
+        salida.agregar(p.textoNombre());
+        salida.agregar(' ');
+        salida.agregarDecimal2(p.patrimonio);
+        salida.agregar('\n');
+        return true;
+    }));
+    return contador;
 }
 
 // Función para calcular el grupo más grande por ciudad (struct y por valor)
-void calcularGrupoMayorPorCiudad(std::vector<Persona> personas) {
-  // Inicialización de las variables
-  int ciudadesGrupos[20][3] = {{0}}; // 20 ciudades, 3 grupos
-  std::unordered_map<std::string, int> ciudadIndex = {
-      {"Bogotá", 0},       {"Medellín", 1},       {"Cali", 2},
-      {"Barranquilla", 3}, {"Cartagena", 4},      {"Bucaramanga", 5},
-      {"Pereira", 6},      {"Santa Marta", 7},    {"Cúcuta", 8},
-      {"Ibagué", 9},       {"Manizales", 10},     {"Pasto", 11},
-      {"Neiva", 12},       {"Villavicencio", 13}, {"Armenia", 14},
-      {"Sincelejo", 15},   {"Valledupar", 16},    {"Montería", 17},
-      {"Popayán", 18},     {"Tunja", 19}};
+void calcularGrupoMayorPorCiudad(Dataset personas) {
+  // Conteo por (ciudad, grupo): el código de ciudad es directamente la fila
+  const size_t numCiudades = diccionarioCiudades().size();
+  std::vector<int> ciudadesGrupos(numCiudades * 3, 0); // 3 grupos por ciudad
 
   // Recorremos las personas y sumamos los grupos
-  for (Persona persona : personas) {  // copia en cada iteración
-    std::string ciudad = persona.ciudadNacimiento; // acceso directo
-    char grupo = persona.grupoDeclaracion;         // acceso directo
-
-    int index1 = ciudadIndex[ciudad];
+  for (const Persona& persona : personas) {
+    char grupo = persona.grupoDeclaracion; //copia del grupo
     if (grupo != 'N') {
       int index2 = (grupo == 'A' ? 0 : (grupo == 'B' ? 1 : 2));
-      ciudadesGrupos[index1][index2]++;
+      ciudadesGrupos[persona.ciudadNacimiento * 3 + index2]++;
     }
   }
 
   // Mostrar el grupo mayor por ciudad
-  for (int i = 0; i < 20; i++) {
-    std::string ciudad;
-    switch (i) {
-    case 0:  ciudad = "Bogotá"; break;
-    case 1:  ciudad = "Medellín"; break;
-    case 2:  ciudad = "Cali"; break;
-    case 3:  ciudad = "Barranquilla"; break;
-    case 4:  ciudad = "Cartagena"; break;
-    case 5:  ciudad = "Bucaramanga"; break;
-    case 6:  ciudad = "Pereira"; break;
-    case 7:  ciudad = "Santa Marta"; break;
-    case 8:  ciudad = "Cúcuta"; break;
-    case 9:  ciudad = "Ibagué"; break;
-    case 10: ciudad = "Manizales"; break;
-    case 11: ciudad = "Pasto"; break;
-    case 12: ciudad = "Neiva"; break;
-    case 13: ciudad = "Villavicencio"; break;
-    case 14: ciudad = "Armenia"; break;
-    case 15: ciudad = "Sincelejo"; break;
-    case 16: ciudad = "Valledupar"; break;
-    case 17: ciudad = "Montería"; break;
-    case 18: ciudad = "Popayán"; break;
-    case 19: ciudad = "Tunja"; break;
-    default: ciudad = "Ciudad no encontrada"; break;
-    }
+  for (size_t i = 0; i < numCiudades; i++) {
+    const int* grupos = &ciudadesGrupos[i * 3];
 
     // Encontramos el grupo con más personas
-    int mayorGrupo = std::max(
-        {ciudadesGrupos[i][0], ciudadesGrupos[i][1], ciudadesGrupos[i][2]});
-    char mayorGrupoLetra = (mayorGrupo == ciudadesGrupos[i][0])   ? 'A'
-                           : (mayorGrupo == ciudadesGrupos[i][1]) ? 'B'
-                                                                  : 'C';
+    int mayorGrupo = std::max({grupos[0], grupos[1], grupos[2]});
+    char mayorGrupoLetra = (mayorGrupo == grupos[0])   ? 'A'
+                           : (mayorGrupo == grupos[1]) ? 'B'
+                                                       : 'C';
 
     // Mostramos el resultado
-    std::cout << "El grupo con más personas en la ciudad " << ciudad
+    std::cout << "El grupo con más personas en la ciudad " << diccionarioCiudades().texto(i)
               << " es el grupo " << mayorGrupoLetra << " con " << mayorGrupo
               << " personas." << std::endl;
   }
 }
 
 // Función que calcula el promedio de patrimonio por ciudad (struct y por valor)
-void calcularPromedioPatrimonio(std::vector<Persona> personas) {
-  double ciudadesPromedios[20] = {0};
-  int conteoCiudad[20] = {0};
+void calcularPromedioPatrimonio(Dataset personas) {
+  // Sumas y conteos indexados por código de ciudad
+  const size_t numCiudades = diccionarioCiudades().size();
+  std::vector<double> ciudadesPromedios(numCiudades, 0.0);
+  std::vector<int> conteoCiudad(numCiudades, 0);
 
   // Recorremos a cada persona y sumamos el patrimonio por ciudad
-  for (Persona persona : personas) {  // copia en cada iteración
-    std::string ciudad = persona.ciudadNacimiento; // acceso directo
-    double patrimonio = persona.patrimonio;        // acceso directo
-
-    // Buscar el índice de la ciudad
-    int index1;
-    for (int i = 0; i < 20; i++) {
-      if (ciudadesColombia[i] == ciudad) {
-        index1 = i;
-        break;
-      }
-    }
-    // Incrementamos la cuenta de personas y sumamos el patrimonio
-    ciudadesPromedios[index1] += patrimonio;
-    conteoCiudad[index1]++;
+  for (const Persona& persona : personas) {
+    CodigoCadena ciudad = persona.ciudadNacimiento;
+    ciudadesPromedios[ciudad] += persona.patrimonio;
+    conteoCiudad[ciudad]++;
   }
   // Creamos un arreglo de pares (promedio, idCiudad) para ordenar
   std::vector<std::pair<float, int>> promediosConId;
 
   // Calculamos los promedios y agregarlos con su ID
-  for (int i = 0; i < 20; i++) {
+  for (size_t i = 0; i < numCiudades; i++) {
     if (conteoCiudad[i] > 0) { // Si hay al menos una persona en esa ciudad
       float promedio = ciudadesPromedios[i] / conteoCiudad[i];
-      promediosConId.push_back({promedio, i}); // Guardar el promedio junto con el ID de la ciudad
+      promediosConId.push_back(
+          {promedio, static_cast<int>(i)}); // Guardar el promedio junto con el ID de la ciudad
     }
   }
 
   // Ordenamos por promedio (en orden descendente)
   std::sort(promediosConId.begin(), promediosConId.end(),
-            [](std::pair<float, int> a, std::pair<float, int> b) {  // por valor para mantener enfoque 100% por valor
-              return a.first > b.first; // Ordenamos por el primer valor (promedio)
+            [](std::pair<float, int> a, std::pair<float, int> b) {  //por valor para mantener enfoque 100% por valor
+              return a.first >
+                     b.first; // Ordenamos por el primer valor (promedio)
             });
 
   std::cout << "Promedio de patrimonio por ciudad:\n";
 
   // Ajustar el formato para mostrar sin notación científica
-  std::cout << std::fixed << std::setprecision(2); // Fija a dos decimales y evita notación científica
+  std::cout << std::fixed
+            << std::setprecision(
+                   2); // Fija a dos decimales y evita notación científica
   std::cout << std::showpoint; // Asegura que se muestren los ceros decimales
 
   for (size_t i = 0; i < 3 && i < promediosConId.size(); ++i) {
     int idCiudad = promediosConId[i].second; // Obtenemos el ID de la ciudad
-    std::cout << ciudadesColombia[idCiudad] << ": " << promediosConId[i].first << std::endl;
+    std::cout << diccionarioCiudades().texto(idCiudad) << ": " << promediosConId[i].first
+              << std::endl;
   }
 }
 
@@ -433,7 +571,7 @@ void calcularPromedioPatrimonio(std::vector<Persona> personas) {
  * @param personas Vector con todas las personas.
  * @return Objeto Persona con mayor deuda, o un objeto Persona vacío si la lista está vacía.
  */
-Persona buscarMayorDeuda(std::vector<Persona> personas) {
+Persona buscarMayorDeuda(Dataset personas) {
     // Si la lista está vacía, devolvemos un objeto Persona vacío
     if (personas.empty()) return generarPersonaVacia();
 
@@ -451,34 +589,32 @@ Persona buscarMayorDeuda(std::vector<Persona> personas) {
  * Imprime un listado de las personas con mayor deuda en cada ciudad (struct y por valor).
  * 
  * POR QUÉ: Encontrar a la persona con mayor deuda en cada ciudad de la colección.
- * CÓMO: Usando un mapa temporal para ir guardando, por ciudad, la persona con
- *       mayor deuda encontrada hasta el momento.
+ * CÓMO: El código de ciudad indexa un arreglo con la persona de
+ *       mayor deuda encontrada hasta el momento (sin hash de strings).
  * PARA QUÉ: Listar y mostrar personas con mayor deuda por ciudad.
  */
-void buscarMayoresDeudasPorCiudad(std::vector<Persona> personas) {
-    std::unordered_map<std::string, Persona> mayoresPorCiudad;
-    mayoresPorCiudad.reserve(personas.size()); // Evita rehashes innecesarios
+void buscarMayoresDeudasPorCiudad(Dataset personas) {
+    // Posición de la persona con mayor deuda de cada ciudad (indexado por código de ciudad)
+    const size_t sinPersona = personas.size();
+    std::vector<size_t> mayoresPorCiudad(diccionarioCiudades().size(), sinPersona);
 
     // Recorremos todas las personas
-    for (auto p : personas) {  // copia en cada iteración
-        std::string ciudad = p.ciudadNacimiento; // acceso directo
-
-        auto it = mayoresPorCiudad.find(ciudad);
-        if (it == mayoresPorCiudad.end()) {
-            // Si la ciudad no existe, la insertamos
-            mayoresPorCiudad.insert({ciudad, p});
-        } else if (p.deudas > it->second.deudas) { // acceso directo
-            // Si existe y tiene más deuda, actualizamos
-            it->second = p;  // copia completa
+    for (size_t i = 0; i < personas.size(); ++i) {
+        size_t& mayor = mayoresPorCiudad[personas[i].ciudadNacimiento];
+        if (mayor == sinPersona || personas[i].deudas > personas[mayor].deudas) {
+            mayor = i;
         }
     }
-
+    // Configuramos el formato: fijo, con decimales (2) → se imprime como decimal
+    std::cout << std::fixed << std::setprecision(2);
     std::cout << "\n=== Personas con mayor deuda por ciudad ===\n";
-    for (auto par : mayoresPorCiudad) { 
-      std::cout << "- " << par.first << ": "
-                << par.second.nombre << " "      // acceso directo
-                << par.second.apellido << " ("   // acceso directo
-                << std::fixed << std::setprecision(2) << par.second.deudas << ")\n"; // acceso directo
+    for (size_t c = 0; c < mayoresPorCiudad.size(); ++c) {
+        if (mayoresPorCiudad[c] == sinPersona) continue; // ciudad sin personas
+        Persona mayor = personas[mayoresPorCiudad[c]];   // copia de la persona
+        std::cout << "- " << diccionarioCiudades().texto(c) << ": "
+                  << mayor.textoNombre() << " "
+                  << mayor.textoApellido() << " ("
+                  << mayor.deudas << ")\n";
     }
 }
 
@@ -490,7 +626,7 @@ void buscarMayoresDeudasPorCiudad(std::vector<Persona> personas) {
  *       mayor deuda encontrada hasta el momento.
  * PARA QUÉ: Listar y mostrar personas con mayor deuda por grupo.
  */
-void buscarMayoresDeudasPorGrupo(std::vector<Persona> personas) {
+void buscarMayoresDeudasPorGrupo(Dataset personas) {
     // Mapa temporal que guarda, por cada grupo, la persona con mayor deuda
     std::unordered_map<char, Persona> mayoresPorGrupo;
     mayoresPorGrupo.reserve(personas.size()); // evita rehashes innecesarios
@@ -513,8 +649,8 @@ void buscarMayoresDeudasPorGrupo(std::vector<Persona> personas) {
     std::cout << "\n=== Personas con mayor deuda por grupo de declaración ===\n";
     for (auto par : mayoresPorGrupo) { 
       std::cout << "- " << par.first << ": "
-                << par.second.nombre << " "      // acceso directo
-                << par.second.apellido << " ("   // acceso directo
+                << par.second.textoNombre() << " "      // acceso directo
+                << par.second.textoApellido() << " ("   // acceso directo
                 << std::fixed << std::setprecision(2) << par.second.deudas << ")\n"; // acceso directo
     }
 }
\ No newline at end of file
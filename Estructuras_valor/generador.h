@@ -2,15 +2,24 @@
 #define GENERADOR_H
 
 #include "persona.h"
+#include "agregados.h"
+#include "aleatorio.h"
+#include "columnas.h"
+#include "dataset.h"
+#include "indice_id.h"
+#include <cstdint>
 #include <vector>
 
 // --- Funciones para generación de datos aleatorios ---
 
-// Genera fecha aleatoria entre 1960-2010
-std::string generarFechaNacimiento();
+// Genera fecha aleatoria entre 1960-2010 (entero AAAAMMDD)
+FechaAAAAMMDD generarFechaNacimiento();
+
+// Genera fecha aleatoria con un generador basado en contador (seguro entre hilos)
+FechaAAAAMMDD generarFechaNacimiento(GeneradorContador& gen);
 
 // Genera ID único secuencial
-std::string generarID();
+uint64_t generarID();
 
 // Genera número decimal en rango [min, max]
 double randomDouble(double min, double max);
@@ -33,69 +42,92 @@ Persona generarPersonaVacia();
  */
 Persona generarPersona();
 
+// Crea la persona número 'indice' de forma determinista a partir de (semilla, indice)
+// El ID es 1000000000 + indice, sin contador global
+Persona generarPersona(uint64_t semilla, uint64_t indice);
+
 // Genera colección de n personas
-std::vector<Persona> generarColeccion(int n);
+ColeccionPersonas generarColeccion(int n);
+
+// Genera colección de n personas repartida entre varios hilos (0 = todos los núcleos)
+// El resultado es idéntico para cualquier número de hilos con la misma semilla
+ColeccionPersonas generarColeccionParalela(int n, uint64_t semilla, unsigned hilos);
+
+// Genera n personas como generarColeccionParalela pero pasa cada una a un AgregadoEnFlujo
+// y la descarta: memoria O(ciudades x grupos) para cualquier n (ver agregados.h)
+AgregadoEnFlujo generarYAgregar(uint64_t n, uint64_t semilla, unsigned hilos);
+
+// Convierte la colección al almacén columnar (ver columnas.h)
+PersonaColumns construirColumnas(Dataset personas);
+
+// Reconstruye la colección a partir del almacén columnar (p. ej. tras cargar una instantánea)
+ColeccionPersonas construirPersonas(const PersonaColumns& columnas);
+
+// Construye el índice ID -> fila (acceso directo si los IDs son consecutivos, hash si no)
+IndiceID construirIndiceID(Dataset personas);
 
-// Busca persona por ID en un vector
+// Busca persona por ID usando el índice de la misma colección (O(1))
 // Retorna una copia de la persona si la encuentra, o una persona vacía si no
-Persona buscarPorID(std::vector<Persona> personas, std::string id);
+Persona buscarPorID(Dataset personas, const IndiceID& indice, uint64_t id);
 
 
 /**
  * Busca la persona con mayor patrimonio en todo el país.
  * Retorna una copia de la persona encontrada (struct, por valor).
  */
-Persona buscarMayorPatrimonio(std::vector<Persona> personas);
+Persona buscarMayorPatrimonio(Dataset personas);
 
 /**
  * Imprime un listado con la persona de mayor patrimonio en cada ciudad.
  * Usa struct y acceso directo a atributos públicos.
  */
-void buscarMayoresPatrimonioPorCiudad(std::vector<Persona> personas);
+void buscarMayoresPatrimonioPorCiudad(Dataset personas);
 
 /**
  * Imprime un listado con la persona de mayor patrimonio por grupo de declaración.
  * Usa struct y por valor.
  */
-void buscarMayoresPatrimonioPorGrupo(std::vector<Persona> personas);
+void buscarMayoresPatrimonioPorGrupo(Dataset personas);
 
 /**
  * Busca la persona con mayor deuda en todo el país.
  * Retorna una copia de la persona encontrada (struct, por valor).
  */
-Persona buscarMayorDeuda(std::vector<Persona> personas);
+Persona buscarMayorDeuda(Dataset personas);
 
 /**
  * Imprime un listado con la persona de mayor deuda en cada ciudad.
  * Usa struct y por valor.
  */
-void buscarMayoresDeudasPorCiudad(std::vector<Persona> personas);
+void buscarMayoresDeudasPorCiudad(Dataset personas);
 
 /**
  * Imprime un listado con la persona de mayor deuda por grupo de declaración.
  * Usa struct y por valor.
  */
-void buscarMayoresDeudasPorGrupo(std::vector<Persona> personas);
+void buscarMayoresDeudasPorGrupo(Dataset personas);
 
-void listarPersonasGrupo(std::vector<Persona> personas, char grupoDeclaracion, int contador);
+// Lista las personas del grupo; el contador llega por valor, así que la cantidad (contador
+// más las listadas) solo vuelve como retorno
+int listarPersonasGrupo(Dataset personas, char grupoDeclaracion, int contador);
 
 /**
  * Obtiene un listado con la persona más longeva de todo el país.
  * Retorna una copia de la persona encontrada (struct, por valor).
  */
-Persona buscarPersonaMasLongevaConCondicion(std::vector<Persona> personas);
+Persona buscarPersonaMasLongevaConCondicion(Dataset personas);
 
 /**
  * Obtiene la persona más longeva de cada ciudad.
  * Usa struct y por valor.
  */
-void mostrarPersonasMasLongevaPorCiudad_Vector(std::vector<Persona> personas);
+void mostrarPersonasMasLongevaPorCiudad_Vector(Dataset personas);
 
 // Definición de la función que calcula el grupo con más personas de cada ciudad
-void calcularGrupoMayorPorCiudad(std::vector<Persona> personas);
+void calcularGrupoMayorPorCiudad(Dataset personas);
 
 // Definición de la función que calcula los promedios de patrimonio por ciudad, y muestra los primeros 3
-void calcularPromedioPatrimonio(std::vector<Persona> personas);
+void calcularPromedioPatrimonio(Dataset personas);
 
 
 #endif // GENERADOR_H
\ No newline at end of file
@@ -0,0 +1,108 @@
+#ifndef GUION_H
+#define GUION_H
+
+#include "columnas.h"
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// Un comando del modo guion: nombre y argumentos, p. ej. "by_city deuda"
+struct ComandoGuion {
+    std::string nombre;
+    std::vector<std::string> argumentos;
+
+    std::string texto() const; // Nombre y argumentos separados por espacios
+};
+
+// Lo que pide la línea de comandos
+struct OpcionesGuion {
+    std::vector<ComandoGuion> comandos;
+    bool detallado = false; // true: además de los resultados, la salida normal de cada consulta
+};
+
+enum class ModoEjecucion {
+    Interactivo, // Sin argumentos: menú por std::cin
+    Guion,       // Ejecutar 'comandos' y salir
+    Terminar     // --help o error de uso, ya explicado; salir con el código indicado
+};
+
+/**
+ * Interpreta argv para el modo guion.
+ *
+ * POR QUÉ: El menú interactivo obliga a las corridas automáticas a simular teclas, y
+ *          cualquier cambio en los submenús las desalinea.
+ * CÓMO: Los argumentos que no son opciones se unen con espacios y se separan en comandos
+ *       por ';' o salto de línea; '--script archivo' (o '-f') agrega los de un archivo,
+ *       donde '#' inicia un comentario. '--verbose' (o '-v') deja ver la salida normal.
+ * PARA QUÉ: Ejecutar, p. ej., programa "generate 10000000; max_patrimonio; export e.csv".
+ *
+ * @param codigoSalida Código con el que terminar cuando se devuelve Terminar.
+ */
+ModoEjecucion interpretarArgumentos(int argc, char* argv[], OpcionesGuion& opciones, int& codigoSalida);
+
+// Separa un texto en comandos (';' o salto de línea) y cada comando en palabras
+std::vector<ComandoGuion> separarComandos(const std::string& texto);
+
+// Lista de comandos aceptados
+void mostrarAyudaGuion(std::ostream& salida);
+
+// Convierte un argumento a entero sin signo; false si no es un número completo
+bool leerEnteroGuion(const std::string& texto, unsigned long long& valor);
+
+/**
+ * Consulta del modo guion, lista para medir: imprime lo mismo que la opción del menú y
+ * devuelve un resultado breve para la columna 'detalle' (conteo, ID o valor; vacío si la
+ * consulta solo imprime una tabla), que llega al TSV aunque la salida normal se descarte.
+ */
+typedef std::function<std::string()> ConsultaGuion;
+
+// Resultados breves de ConsultaGuion: "personas=N" y "id=N"
+std::string detalleConteoGuion(size_t personas);
+std::string detalleIdGuion(unsigned long long id);
+
+/**
+ * Consulta columnar que corresponde a un comando, lista para medir.
+ *
+ * Los comandos de consulta tienen el mismo nombre con layout filas y columnas; cada
+ * main resuelve los de filas con las funciones de su variante y delega aquí los de
+ * columnas, que son comunes a las cuatro.
+ *
+ * @return La consulta, o una función vacía si el comando o sus argumentos no son válidos.
+ */
+ConsultaGuion consultaColumnarGuion(const ComandoGuion& comando, const PersonaColumns& columnas);
+
+// true para los comandos que solo existen en la versión columnar (report, city_group, count...)
+bool esConsultaSoloColumnar(const std::string& nombre);
+
+// Índice de PersonaColumns que usa la consulta columnar del comando (ver PersonaColumns::construirIndice);
+// false si no usa ninguno
+bool indiceColumnarGuion(const ComandoGuion& comando, IndiceColumnar& indice);
+
+/**
+ * Escribe los resultados del modo guion como texto separado por tabuladores.
+ *
+ * POR QUÉ: Los trabajos nocturnos leen los tiempos con un script, no con una persona.
+ * CÓMO: Guarda un duplicado de la salida estándar para los resultados y, salvo en modo
+ *       detallado, manda la salida estándar a /dev/null mientras existe el objeto, así los
+ *       listados y mensajes de las consultas no se mezclan con las filas de resultados.
+ *       La primera línea es la cabecera: comando, estado, tiempo_ms, memoria_kb, detalle.
+ * PARA QUÉ: Una fila por comando que se puede cargar directamente como TSV.
+ */
+class ResultadosGuion {
+public:
+    explicit ResultadosGuion(bool detallado);
+    ~ResultadosGuion();
+    ResultadosGuion(const ResultadosGuion&) = delete;
+    ResultadosGuion& operator=(const ResultadosGuion&) = delete;
+
+    void informar(const ComandoGuion& comando, bool correcto, double tiempo_ms, long memoria_kb,
+                  const std::string& detalle);
+
+private:
+    void escribir(const std::string& linea);
+
+    int fd_resultados_ = -1; // Salida estándar original
+};
+
+#endif // GUION_H
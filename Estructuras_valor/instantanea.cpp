@@ -0,0 +1,245 @@
+#include "instantanea.h"
+#include "paralelo.h" // reducirEnParalelo
+#include <cstdio>   // std::rename, std::remove
+#include <cstring>  // std::memcmp, std::memcpy
+#include <fcntl.h>  // open
+#include <fstream>
+#include <iostream>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h> // close
+
+namespace {
+    const char FIRMA[8] = {'P', 'E', 'R', 'S', 'C', 'O', 'L', '\0'};
+    const uint32_t MARCA_ORDEN_BYTES = 0x01020304; // Se lee distinto si el archivo viene de otra arquitectura
+    const size_t ALINEACION = 64;                  // Cada columna empieza en su propia línea de caché
+    const size_t NUM_COLUMNAS = 10;
+
+    struct Cabecera {
+        char firma[8];
+        uint32_t version;
+        uint32_t ordenBytes;
+        uint64_t filas;
+        uint64_t huellaDiccionarios;               // Los códigos solo valen con los mismos diccionarios
+        uint64_t bytesTotales;                     // Tamaño esperado del archivo
+        uint64_t desplazamiento[NUM_COLUMNAS];     // Inicio de cada columna, múltiplo de ALINEACION
+        uint8_t bytesPorElemento[NUM_COLUMNAS];    // sizeof del tipo de cada columna
+    };
+
+    // Región de una columna en memoria
+    struct Region {
+        const void* datos;
+        size_t bytesPorElemento;
+    };
+
+    size_t alinear(size_t bytes) {
+        return (bytes + ALINEACION - 1) / ALINEACION * ALINEACION;
+    }
+
+    // Regiones en el orden del archivo (el mismo que los campos de PersonaColumns)
+    void regiones(const PersonaColumns& c, Region r[NUM_COLUMNAS]) {
+        r[0] = {c.id.data(), sizeof(uint64_t)};
+        r[1] = {c.nombre.data(), sizeof(CodigoCadena)};
+        r[2] = {c.apellido.data(), sizeof(CodigoCadena)};
+        r[3] = {c.fechaNacimiento.data(), sizeof(FechaAAAAMMDD)};
+        r[4] = {c.ciudad.data(), sizeof(uint8_t)};
+        r[5] = {c.ingresosAnuales.data(), sizeof(double)};
+        r[6] = {c.patrimonio.data(), sizeof(double)};
+        r[7] = {c.deudas.data(), sizeof(double)};
+        r[8] = {c.declaranteRenta.data(), sizeof(uint8_t)};
+        r[9] = {c.grupoDeclaracion.data(), sizeof(char)};
+    }
+
+    // FNV-1a de 64 bits sobre los textos de un diccionario
+    void mezclarDiccionario(uint64_t& huella, const DiccionarioCadenas& diccionario) {
+        auto mezclar = [&huella](unsigned char byte) {
+            huella ^= byte;
+            huella *= 1099511628211ULL;
+        };
+        for (size_t codigo = 0; codigo < diccionario.size(); ++codigo) {
+            for (unsigned char byte : diccionario.texto(static_cast<CodigoCadena>(codigo))) mezclar(byte);
+            mezclar(0); // Separador: "ab","c" != "a","bc"
+        }
+        mezclar(0xFF); // Fin de diccionario
+    }
+
+    uint64_t huellaDiccionarios() {
+        uint64_t huella = 14695981039346656037ULL;
+        mezclarDiccionario(huella, diccionarioNombres());
+        mezclarDiccionario(huella, diccionarioApellidos());
+        mezclarDiccionario(huella, diccionarioCiudades());
+        return huella;
+    }
+
+    Cabecera cabeceraPara(const PersonaColumns& columnas) {
+        Region r[NUM_COLUMNAS];
+        regiones(columnas, r);
+
+        Cabecera cabecera;
+        std::memset(&cabecera, 0, sizeof(cabecera));
+        std::memcpy(cabecera.firma, FIRMA, sizeof(FIRMA));
+        cabecera.version = VERSION_INSTANTANEA;
+        cabecera.ordenBytes = MARCA_ORDEN_BYTES;
+        cabecera.filas = columnas.size();
+        cabecera.huellaDiccionarios = huellaDiccionarios();
+
+        size_t posicion = alinear(sizeof(Cabecera));
+        for (size_t k = 0; k < NUM_COLUMNAS; ++k) {
+            cabecera.desplazamiento[k] = posicion;
+            cabecera.bytesPorElemento[k] = static_cast<uint8_t>(r[k].bytesPorElemento);
+            posicion = alinear(posicion + columnas.size() * r[k].bytesPorElemento);
+        }
+        cabecera.bytesTotales = posicion;
+        return cabecera;
+    }
+
+    // Explica por qué la cabecera no sirve para este ejecutable, o "" si es válida
+    std::string validar(const Cabecera& leida, const Cabecera& esperada, uint64_t bytesArchivo) {
+        if (std::memcmp(leida.firma, FIRMA, sizeof(FIRMA)) != 0) return "no es una instantánea de personas";
+        if (leida.ordenBytes != MARCA_ORDEN_BYTES) return "orden de bytes distinto al de esta máquina";
+        if (leida.version != VERSION_INSTANTANEA) {
+            return "versión " + std::to_string(leida.version) + ", se esperaba " + std::to_string(VERSION_INSTANTANEA);
+        }
+        if (leida.huellaDiccionarios != esperada.huellaDiccionarios) return "los diccionarios de nombres no coinciden";
+        if (std::memcmp(leida.bytesPorElemento, esperada.bytesPorElemento, NUM_COLUMNAS) != 0) {
+            return "tamaños de columna distintos";
+        }
+        if (leida.bytesTotales != bytesArchivo) return "archivo truncado o con bytes de más";
+        for (size_t k = 0; k < NUM_COLUMNAS; ++k) {
+            const uint64_t elemento = leida.bytesPorElemento[k];
+            if (leida.desplazamiento[k] % ALINEACION != 0 || leida.desplazamiento[k] > bytesArchivo ||
+                leida.filas > (bytesArchivo - leida.desplazamiento[k]) / elemento) {
+                return "columna " + std::to_string(k) + " fuera del archivo";
+            }
+        }
+        return "";
+    }
+
+    /**
+     * Explica qué columna de códigos se sale de su diccionario, o "" si todas son válidas.
+     *
+     * POR QUÉ: La huella solo prueba que los diccionarios son los mismos; un archivo dañado
+     *          puede traer cualquier byte en las columnas, y el código de ciudad se usa
+     *          directamente como índice de arreglos y los de nombre en texto().
+     * CÓMO: Un recorrido de ciudad, nombre y apellido repartido entre hilos; cada fila
+     *       marca con un bit la columna cuyo código no existe en su diccionario.
+     */
+    std::string validarCodigos(const PersonaColumns& c) {
+        const size_t numCiudades = diccionarioCiudades().size();
+        const size_t numNombres = diccionarioNombres().size();
+        const size_t numApellidos = diccionarioApellidos().size();
+        const uint8_t* ciudades = c.ciudad.data();
+        const CodigoCadena* nombres = c.nombre.data();
+        const CodigoCadena* apellidos = c.apellido.data();
+
+        const unsigned fuera = reducirEnParalelo(c.size(), 0, 0u,
+            [&](size_t inicio, size_t fin, unsigned& parcial) {
+                for (size_t i = inicio; i < fin; ++i) {
+                    parcial |= (ciudades[i] >= numCiudades ? 1u : 0u) | (nombres[i] >= numNombres ? 2u : 0u) |
+                               (apellidos[i] >= numApellidos ? 4u : 0u);
+                }
+            },
+            [](unsigned& acumulado, unsigned parcial) { acumulado |= parcial; });
+        if (fuera & 1u) return "códigos de ciudad fuera del diccionario";
+        if (fuera & 2u) return "códigos de nombre fuera del diccionario";
+        if (fuera & 4u) return "códigos de apellido fuera del diccionario";
+        return "";
+    }
+
+    template <typename T>
+    void enlazarColumna(Columna<T>& columna, const char* base, const Cabecera& cabecera, size_t k) {
+        columna.enlazar(reinterpret_cast<const T*>(base + cabecera.desplazamiento[k]), cabecera.filas);
+    }
+}
+
+bool guardarInstantanea(const PersonaColumns& columnas, const std::string& ruta) {
+    const Cabecera cabecera = cabeceraPara(columnas);
+    Region r[NUM_COLUMNAS];
+    regiones(columnas, r);
+
+    const std::string temporal = ruta + ".tmp";
+    {
+        std::ofstream salida(temporal, std::ios::binary | std::ios::trunc);
+        if (!salida) {
+            std::cerr << "[instantanea] No se pudo crear " << temporal << "\n";
+            return false;
+        }
+        const char relleno[ALINEACION] = {};
+        salida.write(reinterpret_cast<const char*>(&cabecera), sizeof(cabecera));
+        size_t posicion = sizeof(cabecera);
+        for (size_t k = 0; k < NUM_COLUMNAS; ++k) {
+            salida.write(relleno, static_cast<std::streamsize>(cabecera.desplazamiento[k] - posicion));
+            const size_t bytes = columnas.size() * r[k].bytesPorElemento;
+            if (bytes > 0) salida.write(static_cast<const char*>(r[k].datos), static_cast<std::streamsize>(bytes));
+            posicion = cabecera.desplazamiento[k] + bytes;
+        }
+        salida.write(relleno, static_cast<std::streamsize>(cabecera.bytesTotales - posicion));
+        salida.flush();
+        if (!salida) {
+            std::cerr << "[instantanea] Error al escribir " << temporal << "\n";
+            std::remove(temporal.c_str());
+            return false;
+        }
+    }
+    if (std::rename(temporal.c_str(), ruta.c_str()) != 0) {
+        std::cerr << "[instantanea] No se pudo renombrar " << temporal << " a " << ruta << "\n";
+        std::remove(temporal.c_str());
+        return false;
+    }
+    return true;
+}
+
+bool cargarInstantanea(const std::string& ruta, PersonaColumns& columnas) {
+    int fd = open(ruta.c_str(), O_RDONLY);
+    if (fd < 0) {
+        std::cerr << "[instantanea] No se pudo abrir " << ruta << "\n";
+        return false;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0 || static_cast<uint64_t>(info.st_size) < sizeof(Cabecera)) {
+        std::cerr << "[instantanea] " << ruta << " es demasiado pequeño para ser una instantánea\n";
+        close(fd);
+        return false;
+    }
+    const size_t bytesArchivo = static_cast<size_t>(info.st_size);
+    void* mapa = mmap(nullptr, bytesArchivo, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd); // El mapa sigue válido sin el descriptor
+    if (mapa == MAP_FAILED) {
+        std::cerr << "[instantanea] mmap falló para " << ruta << "\n";
+        return false;
+    }
+    std::shared_ptr<const void> almacen(mapa, [bytesArchivo](const void* p) {
+        munmap(const_cast<void*>(p), bytesArchivo);
+    });
+
+    const char* base = static_cast<const char*>(mapa);
+    Cabecera cabecera;
+    std::memcpy(&cabecera, base, sizeof(cabecera));
+    const std::string error = validar(cabecera, cabeceraPara(PersonaColumns()), bytesArchivo);
+    if (!error.empty()) {
+        std::cerr << "[instantanea] " << ruta << ": " << error << "\n";
+        return false;
+    }
+
+    PersonaColumns cargadas;
+    enlazarColumna(cargadas.id, base, cabecera, 0);
+    enlazarColumna(cargadas.nombre, base, cabecera, 1);
+    enlazarColumna(cargadas.apellido, base, cabecera, 2);
+    enlazarColumna(cargadas.fechaNacimiento, base, cabecera, 3);
+    enlazarColumna(cargadas.ciudad, base, cabecera, 4);
+    enlazarColumna(cargadas.ingresosAnuales, base, cabecera, 5);
+    enlazarColumna(cargadas.patrimonio, base, cabecera, 6);
+    enlazarColumna(cargadas.deudas, base, cabecera, 7);
+    enlazarColumna(cargadas.declaranteRenta, base, cabecera, 8);
+    enlazarColumna(cargadas.grupoDeclaracion, base, cabecera, 9);
+    cargadas.almacen = std::move(almacen);
+    const std::string errorCodigos = validarCodigos(cargadas);
+    if (!errorCodigos.empty()) {
+        std::cerr << "[instantanea] " << ruta << ": " << errorCodigos << "\n";
+        return false;
+    }
+    cargadas.indexarIDs();
+
+    columnas = std::move(cargadas);
+    return true;
+}
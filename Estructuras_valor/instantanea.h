@@ -0,0 +1,41 @@
+#ifndef INSTANTANEA_H
+#define INSTANTANEA_H
+
+#include "columnas.h"
+#include <cstdint>
+#include <string>
+
+// Versión del formato; cambia cuando cambie la cabecera o el tipo de alguna columna
+const uint32_t VERSION_INSTANTANEA = 1;
+
+/**
+ * Guarda las columnas en un archivo binario versionado.
+ *
+ * POR QUÉ: Regenerar 10M personas tarda segundos y, con la opción 0, da datos distintos
+ *          en cada ejecución; para comparar corridas hace falta el mismo conjunto.
+ * CÓMO: Cabecera fija (firma, versión, marca de orden de bytes, filas, huella de los
+ *       diccionarios y desplazamiento de cada columna) seguida de cada columna tal como
+ *       está en memoria, alineada a 64 bytes. Se escribe en 'ruta.tmp' y se renombra al
+ *       terminar, así un corte a mitad no deja una instantánea dañada con el nombre final.
+ * PARA QUÉ: Que cargarInstantanea() pueda mapear el archivo y usarlo sin convertir nada.
+ *
+ * @return true si se escribió completo; si no, explica el error en std::cerr.
+ */
+bool guardarInstantanea(const PersonaColumns& columnas, const std::string& ruta);
+
+/**
+ * Carga una instantánea mapeándola en memoria (mmap), sin leerla ni convertirla.
+ *
+ * POR QUÉ: Leer y convertir el archivo costaría casi lo mismo que generar los datos.
+ * CÓMO: Mapea el archivo completo de solo lectura, valida la cabecera (firma, versión,
+ *       orden de bytes, tamaños y que los diccionarios de este ejecutable sean los mismos
+ *       con los que se guardó) y enlaza cada columna a su región del mapa. El sistema
+ *       operativo lee las páginas a medida que las consultas las tocan. 'columnas.almacen'
+ *       mantiene el mapa hasta que la última copia de las columnas se destruye.
+ * PARA QUÉ: Arrancar con millones de registros en milisegundos.
+ *
+ * @return true si se cargó; si no, deja 'columnas' sin cambios y explica el error en std::cerr.
+ */
+bool cargarInstantanea(const std::string& ruta, PersonaColumns& columnas);
+
+#endif // INSTANTANEA_H
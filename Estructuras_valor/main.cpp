@@ -1,7 +1,14 @@
+#include "agregados.h"
 #include "generador.h"
+#include "guion.h"
+#include "instantanea.h"
 #include "monitor.h"
 #include "persona.h"
+#include "salida.h"
+#include "vectorial.h"
+#include <cctype>  // std::toupper
 #include <cstddef>
+#include <functional>
 #include <iostream>
 #include <vector>
 #include <limits>
@@ -30,9 +37,269 @@ void mostrarMenu() {
     std::cout << "\n9. 3 ciudades con mayor promedio de patrimonio";
     std::cout << "\n10. Persona con mayor deuda";
     std::cout << "\n11. Salir";
+    std::cout << "\n12. Crear conjunto de datos en paralelo (semilla fija)";
+    std::cout << "\n13. Consultas columnares (PersonaColumns)";
+    std::cout << "\n14. Guardar instantánea binaria";
+    std::cout << "\n15. Cargar instantánea binaria (mmap)";
+    std::cout << "\n16. Activar/desactivar contadores de hardware (perf)";
+    std::cout << "\n17. Modo benchmark: repetir las consultas de las opciones 5 a 10 y 13";
+    std::cout << "\n18. Estadísticas por ciudad sin guardar las personas (flujo)";
+    std::cout << "\n19. Hilos para los listados (salida en paralelo)";
     std::cout << "\nSeleccione una opción: ";
 }
 
+// Modo guion (ver guion.h): ejecuta los comandos sobre esta variante, con el mismo estado
+// que el menú, mide cada consulta como la opción 13 y se detiene en el primer error.
+// Devuelve 0 si todos los comandos se ejecutaron y 1 si alguno falló.
+int ejecutarGuion(const OpcionesGuion& opciones) {
+    Monitor monitor;
+    Dataset personas;
+    PersonaColumns columnas;
+    bool columnasVigentes = false;
+    IndiceID indiceID;
+    bool indiceVigente = false;
+    bool usarColumnas = false; // 'layout columnas': las consultas usan PersonaColumns
+    ResultadosGuion resultados(opciones.detallado);
+
+    // Construyen lo que falte; su costo se registra aparte como en el menú
+    auto construir = [&](const std::string& nombre, const std::function<void()>& construccion) {
+        monitor.iniciar_tiempo();
+        long memoria_inicio = monitor.obtener_memoria();
+        construccion();
+        double tiempo = monitor.detener_tiempo();
+        monitor.registrar(nombre, tiempo, monitor.obtener_memoria() - memoria_inicio);
+    };
+    auto asegurarColumnas = [&]() {
+        if (columnasVigentes || personas.empty()) return;
+        construir("Construir columnas", [&]{ columnas = construirColumnas(personas); });
+        columnasVigentes = true;
+    };
+    auto asegurarPersonas = [&]() {
+        if (!personas.empty() || !columnasVigentes || columnas.empty()) return;
+        construir("Reconstruir personas", [&]{ personas = construirPersonas(columnas); });
+    };
+    auto asegurarIndiceID = [&]() {
+        if (indiceVigente || personas.empty()) return;
+        construir("Construir índice de IDs", [&]{ indiceID = construirIndiceID(personas); });
+        indiceVigente = true;
+    };
+    auto asegurarIndiceColumnar = [&](IndiceColumnar indice) {
+        if (columnas.indiceListo(indice)) return;
+        construir(std::string("Construir ") + NOMBRES_INDICE_COLUMNAR[static_cast<int>(indice)],
+                  [&]{ columnas.construirIndice(indice); });
+    };
+
+    for (const ComandoGuion& comando : opciones.comandos) {
+        const std::string& c = comando.nombre;
+        const size_t nArgs = comando.argumentos.size();
+        const std::string argumento = nArgs > 0 ? comando.argumentos[0] : "";
+        std::string error;
+        std::string detalle;
+        double tiempo = 0;
+        long memoria = 0;
+
+        // Consulta por filas con las funciones de esta variante; vacía si no existe
+        auto consultaFilas = [&]() -> ConsultaGuion {
+            if (c == "max_patrimonio" && nArgs == 0) {
+                return [&]{
+                    Persona p = buscarMayorPatrimonio(personas);
+                    if (p.id == 0) return std::string();
+                    p.mostrar();
+                    return detalleIdGuion(p.id);
+                };
+            }
+            if (c == "max_deuda" && nArgs == 0) {
+                return [&]{
+                    Persona p = buscarMayorDeuda(personas);
+                    if (p.id == 0) return std::string();
+                    p.mostrar();
+                    return detalleIdGuion(p.id);
+                };
+            }
+            if (c == "longeva" && nArgs == 0) {
+                return [&]{
+                    Persona p = buscarPersonaMasLongevaConCondicion(personas);
+                    if (p.id == 0) return std::string();
+                    p.mostrar();
+                    return detalleIdGuion(p.id);
+                };
+            }
+            if (c == "by_city" && nArgs == 1) {
+                if (argumento == "patrimonio") {
+                    return [&]{ buscarMayoresPatrimonioPorCiudad(personas); return std::string(); };
+                }
+                if (argumento == "deuda") return [&]{ buscarMayoresDeudasPorCiudad(personas); return std::string(); };
+                if (argumento == "longeva") {
+                    return [&]{ mostrarPersonasMasLongevaPorCiudad_Vector(personas); return std::string(); };
+                }
+            }
+            if (c == "by_group" && nArgs == 1) {
+                if (argumento == "patrimonio") {
+                    return [&]{ buscarMayoresPatrimonioPorGrupo(personas); return std::string(); };
+                }
+                if (argumento == "deuda") return [&]{ buscarMayoresDeudasPorGrupo(personas); return std::string(); };
+            }
+            if (c == "group" && nArgs == 1 && argumento.size() == 1) {
+                const char grupo = static_cast<char>(std::toupper(static_cast<unsigned char>(argumento[0])));
+                if (grupo == 'A' || grupo == 'B' || grupo == 'C') {
+                    return [&, grupo]{
+                        // El contador va por valor en esta variante: la cantidad vuelve como retorno
+                        const int conteo = listarPersonasGrupo(personas, grupo, 0);
+                        std::cout << "\nAl grupo " << grupo << " pertenecen " << conteo << " personas\n";
+                        return detalleConteoGuion(static_cast<size_t>(conteo));
+                    };
+                }
+            }
+            if (c == "top_group_by_city" && nArgs == 0) {
+                return [&]{ calcularGrupoMayorPorCiudad(personas); return std::string(); };
+            }
+            if (c == "avg_patrimonio_by_city" && nArgs == 0) {
+                return [&]{ calcularPromedioPatrimonio(personas); return std::string(); };
+            }
+            unsigned long long id;
+            if (c == "find" && nArgs == 1 && leerEnteroGuion(argumento, id)) {
+                return [&, id]{
+                    Persona encontrada = buscarPorID(personas, indiceID, id);
+                    if (encontrada.id != 0) {
+                        encontrada.mostrar();
+                    } else {
+                        std::cout << "No se encontró persona con ID " << id << "\n";
+                    }
+                    return encontrada.id != 0 ? detalleIdGuion(encontrada.id) : std::string();
+                };
+            }
+            return nullptr;
+        };
+
+        // Mide una consulta igual que medirConsulta en la opción 13; su resultado breve
+        // (conteo, ID o valor) va a la columna 'detalle'
+        auto medir = [&](const ConsultaGuion& consulta) {
+            monitor.iniciar_tiempo();
+            memoria = monitor.medir_memoria_funcion_kb(consulta, detalle);
+            tiempo = monitor.detener_tiempo();
+            monitor.registrar(comando.texto(), tiempo, memoria);
+            if (monitor.repeticiones() > 0) {
+                tiempo = monitor.medir_repeticiones(comando.texto() + " [repeticiones]", [&consulta]{ consulta(); });
+                if (!detalle.empty()) detalle += " ";
+                detalle += "mediana de " + std::to_string(monitor.repeticiones()) + " repeticiones";
+            }
+        };
+
+        if (c == "generate") {
+            unsigned long long n = 0, semilla = 42, hilos = 0;
+            if (nArgs < 1 || nArgs > 3 || !leerEnteroGuion(comando.argumentos[0], n) || n == 0 ||
+                n > static_cast<unsigned long long>(std::numeric_limits<int>::max()) ||
+                (nArgs >= 2 && !leerEnteroGuion(comando.argumentos[1], semilla)) ||
+                (nArgs == 3 && !leerEnteroGuion(comando.argumentos[2], hilos))) {
+                error = "uso: generate N [semilla] [hilos]";
+            } else {
+                monitor.iniciar_tiempo();
+                long memoria_inicio = monitor.obtener_memoria();
+                personas = generarColeccionParalela(static_cast<int>(n), semilla, static_cast<unsigned>(hilos));
+                columnasVigentes = false;
+                indiceVigente = false;
+                tiempo = monitor.detener_tiempo();
+                memoria = monitor.obtener_memoria() - memoria_inicio;
+                monitor.registrar(comando.texto(), tiempo, memoria);
+                detalle = "filas=" + std::to_string(personas.size());
+            }
+        } else if (c == "stream") {
+            unsigned long long n = 0, semilla = 42, hilos = 0;
+            if (nArgs < 1 || nArgs > 3 || !leerEnteroGuion(comando.argumentos[0], n) || n == 0 ||
+                (nArgs >= 2 && !leerEnteroGuion(comando.argumentos[1], semilla)) ||
+                (nArgs == 3 && !leerEnteroGuion(comando.argumentos[2], hilos))) {
+                error = "uso: stream N [semilla] [hilos]";
+            } else {
+                monitor.iniciar_tiempo();
+                monitor.iniciar_memoria_pico();
+                AgregadoEnFlujo agregado = generarYAgregar(n, semilla, static_cast<unsigned>(hilos));
+                tiempo = monitor.detener_tiempo();
+                memoria = monitor.memoria_pico_delta_kb();
+                monitor.registrar(comando.texto(), tiempo, memoria);
+                mostrarAgregadoEnFlujo(agregado);
+                detalle = "personas=" + std::to_string(agregado.personas);
+            }
+        } else if (c == "load" && nArgs == 1) {
+            monitor.iniciar_tiempo();
+            long memoria_inicio = monitor.obtener_memoria();
+            if (cargarInstantanea(argumento, columnas)) {
+                personas.clear();
+                columnasVigentes = true;
+                indiceVigente = false;
+                detalle = "filas=" + std::to_string(columnas.size());
+            } else {
+                error = "no se pudo cargar " + argumento;
+            }
+            tiempo = monitor.detener_tiempo();
+            memoria = monitor.obtener_memoria() - memoria_inicio;
+            monitor.registrar(comando.texto(), tiempo, memoria);
+        } else if (c == "save" && nArgs == 1) {
+            asegurarColumnas();
+            if (!columnasVigentes) {
+                error = "no hay datos (use generate o load)";
+            } else {
+                monitor.iniciar_tiempo();
+                if (!guardarInstantanea(columnas, argumento)) error = "no se pudo guardar " + argumento;
+                tiempo = monitor.detener_tiempo();
+                monitor.registrar(comando.texto(), tiempo, 0);
+                detalle = "filas=" + std::to_string(columnas.size());
+            }
+        } else if (c == "layout" && nArgs == 1 && (argumento == "filas" || argumento == "columnas")) {
+            usarColumnas = argumento == "columnas";
+            detalle = argumento;
+        } else if (c == "counters" && nArgs == 1 && (argumento == "on" || argumento == "off")) {
+            // Sin contadores disponibles no es un error: se sigue midiendo tiempo y memoria
+            if (argumento == "off") monitor.desactivar_contadores();
+            else if (!monitor.contadores_activos()) monitor.activar_contadores();
+            detalle = monitor.contadores_activos() ? "activos" : "no disponibles";
+        } else if (c == "repeat" && (nArgs == 1 || nArgs == 2)) {
+            unsigned long long repeticiones = 0, calentamiento = 0;
+            if (!leerEnteroGuion(comando.argumentos[0], repeticiones) ||
+                (nArgs == 2 && !leerEnteroGuion(comando.argumentos[1], calentamiento)) ||
+                repeticiones > 1000000 || calentamiento > 1000000) {
+                error = "uso: repeat N [calentamiento]";
+            } else {
+                monitor.configurar_repeticiones(static_cast<int>(repeticiones), static_cast<int>(calentamiento));
+                detalle = "repeticiones=" + std::to_string(monitor.repeticiones());
+            }
+        } else if (c == "output_threads" && nArgs == 1) {
+            unsigned long long hilos = 0;
+            if (!leerEnteroGuion(argumento, hilos) || hilos > MAXIMO_HILOS_SALIDA) {
+                error = "uso: output_threads N (1 = secuencial, 0 = todos los núcleos)";
+            } else {
+                fijarHilosSalida(static_cast<unsigned>(hilos));
+                detalle = "hilos=" + std::to_string(hilosEfectivos(hilosSalida()));
+            }
+        } else if (c == "export" && nArgs == 1) {
+            if (monitor.exportar_csv(argumento)) detalle = argumento;
+            else error = "no se pudo escribir " + argumento;
+        } else {
+            // Consultas: algunas existen solo en la versión columnar (ver esConsultaSoloColumnar)
+            const bool columnar = usarColumnas || esConsultaSoloColumnar(c);
+            ConsultaGuion consulta = columnar ? consultaColumnarGuion(comando, columnas) : consultaFilas();
+            if (!consulta) {
+                error = "comando desconocido o argumentos inválidos (ver --help)";
+            } else if (personas.empty() && !columnasVigentes) {
+                error = "no hay datos (use generate o load)";
+            } else {
+                if (columnar) {
+                    asegurarColumnas();
+                    IndiceColumnar indice;
+                    if (indiceColumnarGuion(comando, indice)) asegurarIndiceColumnar(indice);
+                } else {
+                    asegurarPersonas();
+                    if (c == "find") asegurarIndiceID();
+                }
+                medir(consulta);
+            }
+        }
+
+        resultados.informar(comando, error.empty(), tiempo, memoria, error.empty() ? detalle : error);
+        if (!error.empty()) return 1;
+    }
+    return 0;
+}
+
 /**
  * Punto de entrada principal del programa.
  *
@@ -40,11 +307,93 @@ void mostrarMenu() {
  * CÓMO: Mediante un bucle que muestra el menú y procesa la opción seleccionada.
  * PARA QUÉ: Ejecutar las funcionalidades del sistema.
  */
-int main() {
+int main(int argc, char* argv[]) {
+    // Con argumentos, modo guion (sin menú); ver guion.h
+    OpcionesGuion opcionesGuion;
+    int codigoSalida = 0;
+    switch (interpretarArgumentos(argc, argv, opcionesGuion, codigoSalida)) {
+        case ModoEjecucion::Guion: return ejecutarGuion(opcionesGuion);
+        case ModoEjecucion::Terminar: return codigoSalida;
+        case ModoEjecucion::Interactivo: break;
+    }
+
     srand(time(nullptr)); // Semilla para generación aleatoria
-    std::vector<Persona> personas;
+    Dataset personas;
 
     Monitor monitor; // Monitor para medir rendimiento
+    // Almacén columnar; se reconstruye cuando cambia el conjunto de datos
+    PersonaColumns columnas;
+    bool columnasVigentes = false;
+    // Índice ID -> fila para buscar por ID; se reconstruye cuando cambia el conjunto de datos
+    IndiceID indiceID;
+    bool indiceVigente = false;
+
+    // Construye el índice si está desactualizado y registra su costo aparte de la búsqueda
+    auto asegurarIndiceID = [&]() {
+        if (indiceVigente || personas.empty()) return;
+        monitor.iniciar_tiempo();
+        long memoria_inicio = monitor.obtener_memoria();
+        indiceID = construirIndiceID(personas);
+        indiceVigente = true;
+        double tiempo_indice = monitor.detener_tiempo();
+        long memoria_indice = monitor.obtener_memoria() - memoria_inicio;
+        monitor.mostrar_estadistica("Construir índice de IDs", tiempo_indice, memoria_indice);
+        monitor.registrar("Construir índice de IDs", tiempo_indice, memoria_indice);
+    };
+
+    // Construye las columnas si están desactualizadas (una vez por conjunto de datos)
+    auto asegurarColumnas = [&]() {
+        if (columnasVigentes || personas.empty()) return;
+        monitor.iniciar_tiempo();
+        long memoria_inicio = monitor.obtener_memoria();
+        columnas = construirColumnas(personas);
+        columnasVigentes = true;
+        double tiempo_col = monitor.detener_tiempo();
+        long memoria_col = monitor.obtener_memoria() - memoria_inicio;
+        monitor.mostrar_estadistica("Construir columnas", tiempo_col, memoria_col);
+        monitor.registrar("Construir columnas", tiempo_col, memoria_col);
+        // La primera consulta elige los núcleos SSE2/AVX2 y los compara con la versión escalar
+        std::cout << "Núcleos vectoriales: " << nombreNivelSimd(nivelSimdActivo())
+                  << (verificarNucleosVectoriales() ? " (verificados)" : " (no coinciden con la versión escalar)") << "\n";
+    };
+
+    // Mide y registra una consulta de las opciones 5 a 10 y 13. En modo benchmark
+    // (opción 17) además repite la consulta y registra la serie con sus percentiles
+    auto medirConsulta = [&](const std::string& nombre, const std::function<void()>& consulta) {
+        monitor.iniciar_tiempo();
+        long memoria_consulta = monitor.medir_memoria_funcion_kb(consulta);
+        double tiempo_consulta = monitor.detener_tiempo();
+        monitor.mostrar_estadistica(nombre, tiempo_consulta, memoria_consulta);
+        monitor.registrar(nombre, tiempo_consulta, memoria_consulta);
+        if (monitor.repeticiones() > 0) monitor.medir_repeticiones(nombre + " [repeticiones]", consulta);
+    };
+
+    // Construye un índice perezoso de las columnas antes de medir la consulta que lo usa: la
+    // consulta corre en un proceso hijo y lo que construyera ahí se perdería con él
+    auto asegurarIndiceColumnar = [&](IndiceColumnar indice) {
+        if (columnas.indiceListo(indice)) return;
+        monitor.iniciar_tiempo();
+        long memoria_inicio = monitor.obtener_memoria();
+        columnas.construirIndice(indice);
+        double tiempo_indice = monitor.detener_tiempo();
+        long memoria_indice = monitor.obtener_memoria() - memoria_inicio;
+        const std::string nombre = std::string("Construir ") + NOMBRES_INDICE_COLUMNAR[static_cast<int>(indice)];
+        monitor.mostrar_estadistica(nombre, tiempo_indice, memoria_indice);
+        monitor.registrar(nombre, tiempo_indice, memoria_indice);
+    };
+
+    // Tras cargar una instantánea solo existen las columnas; la colección por filas
+    // se reconstruye la primera vez que una opción la necesita
+    auto asegurarPersonas = [&]() {
+        if (!personas.empty() || !columnasVigentes || columnas.empty()) return;
+        monitor.iniciar_tiempo();
+        long memoria_inicio = monitor.obtener_memoria();
+        personas = construirPersonas(columnas);
+        double tiempo_filas = monitor.detener_tiempo();
+        long memoria_filas = monitor.obtener_memoria() - memoria_inicio;
+        monitor.mostrar_estadistica("Reconstruir personas", tiempo_filas, memoria_filas);
+        monitor.registrar("Reconstruir personas", tiempo_filas, memoria_filas);
+    };
     
     int opcion;
     do {
@@ -54,7 +403,7 @@ int main() {
         // Variables locales para uso en los casos
         size_t tam = 0;
         int indice;
-        std::string idBusqueda;
+        uint64_t idBusqueda = 0;
         int filtradoPersonaLongeva;
         int filtradoPersonaPatrimonio;
         int listadoGrupos;
@@ -64,6 +413,9 @@ int main() {
         int filtradoPersonaDeuda;
         long memoria_inicio;
         
+        // Las opciones 1 a 10 (salvo las estadísticas) trabajan sobre la colección por filas
+        if (opcion >= 1 && opcion <= 10 && opcion != 4) asegurarPersonas();
+
         switch(opcion) {
             case 0: { // Crear nuevo conjunto de datos
                 int n;
@@ -84,6 +436,8 @@ int main() {
                 
                 // Mover el conjunto 
                 personas = std::move(nuevasPersonas);
+                columnasVigentes = false;
+                indiceVigente = false;
                 
                 // Medir tiempo y memoria usada
                 double tiempo_gen = monitor.detener_tiempo();
@@ -108,11 +462,15 @@ int main() {
                 
                 tam = personas.size();
                 std::cout << "\n=== RESUMEN DE PERSONAS (" << tam << ") ===\n";
-                for(size_t i = 0; i < tam; ++i) {
-                    std::cout << i << ". ";
-                    personas[i].mostrarResumen();
-                    std::cout << "\n";
-                }
+                // Cada línea se formatea en búferes propios y se escribe con write(2) por bloques;
+                // con muchas filas y hilos pedidos (opción 19) el formateo se reparte conservando el orden
+                escribirRegistros(tam, hilosSalida(), [&](size_t i, BufferTexto& salida) {
+                    salida.agregarEntero(i);
+                    salida.agregar(". ");
+                    personas[i].formatearResumen(salida);
+                    salida.agregar('\n');
+                    return true;
+                });
                 
                 double tiempo_mostrar = monitor.detener_tiempo();
                 long memoria_mostrar = monitor.obtener_memoria() - memoria_inicio;
@@ -153,6 +511,7 @@ int main() {
             }
                 
             case 3: { // Buscar por ID
+                asegurarIndiceID(); // Se construye fuera de la medición de la búsqueda
                 monitor.iniciar_tiempo();
                 long memoria_inicio = monitor.obtener_memoria();
                 if (personas.empty()) {
@@ -161,13 +520,17 @@ int main() {
                 }
                 
                 std::cout << "\nIngrese el ID a buscar: ";
-                std::cin >> idBusqueda;
-
-                Persona encontrada = buscarPorID(personas, idBusqueda);
-                if (encontrada.id == idBusqueda) {
-                    encontrada.mostrar();
+                if (!(std::cin >> idBusqueda)) {
+                    std::cout << "Entrada inválida!\n";
+                    std::cin.clear();
+                    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
                 } else {
-                    std::cout << "No se encontró persona con ID " << idBusqueda << "\n";
+                    Persona encontrada = buscarPorID(personas, indiceID, idBusqueda);
+                    if (encontrada.id != 0) {
+                        encontrada.mostrar();
+                    } else {
+                        std::cout << "No se encontró persona con ID " << idBusqueda << "\n";
+                    }
                 }
                 
                 double tiempo_busqueda = monitor.detener_tiempo();
@@ -194,30 +557,20 @@ int main() {
 
                 switch (filtradoPersonaLongeva) {
                     case 1: { // Persona mas longeva por país
-                        monitor.iniciar_tiempo();
-                        long memoria_busqueda = monitor.medir_memoria_funcion_kb([&]{
+                        medirConsulta("Persona más longeva en Colombia", [&]{
                             Persona p = buscarPersonaMasLongevaConCondicion(personas);
-                            if (p.id != "") {
+                            if (p.id != 0) {
                                 std::cout << "\n=== Persona más longeva en Colombia ===\n";
                                 p.mostrar();
                             }
                         });
-
-                        double tiempo_busqueda = monitor.detener_tiempo();
-                        monitor.mostrar_estadistica("Persona más longeva en Colombia", tiempo_busqueda, memoria_busqueda);
-                        monitor.registrar("Persona más longeva en Colombia", tiempo_busqueda, memoria_busqueda);
                         break;
                     }
 
                     case 2: { // Persona mas longeva por ciudad
-                        monitor.iniciar_tiempo();
-                        long memoria_busqueda = monitor.medir_memoria_funcion_kb([&]{
+                        medirConsulta("Persona más longeva por ciudad", [&]{
                             mostrarPersonasMasLongevaPorCiudad_Vector(personas);
                         });
-
-                        double tiempo_busqueda = monitor.detener_tiempo();
-                        monitor.mostrar_estadistica("Persona más longeva por ciudad", tiempo_busqueda, memoria_busqueda);
-                        monitor.registrar("Persona más longeva por ciudad", tiempo_busqueda, memoria_busqueda);
                         break;
                     }
 
@@ -241,43 +594,27 @@ int main() {
 
                 switch (filtradoPersonaPatrimonio) {
                     case 1: { // Mayor patrimonio en Colombia
-                        monitor.iniciar_tiempo();
-
-                        long memoria_busqueda = monitor.medir_memoria_funcion_kb([&]{
+                        medirConsulta("Mayor patrimonio en Colombia", [&]{
                             Persona p = buscarMayorPatrimonio(personas);
-                            if (p.id != "") {
+                            if (p.id != 0) {
                                 std::cout << "\n=== Persona con mayor patrimonio en Colombia ===\n";
                                 p.mostrar();
                             }
                         });
-
-                        double tiempo_busqueda = monitor.detener_tiempo();
-                        monitor.mostrar_estadistica("Mayor patrimonio en Colombia", tiempo_busqueda, memoria_busqueda);
-                        monitor.registrar("Mayor patrimonio en Colombia", tiempo_busqueda, memoria_busqueda);
                         break;
                     }
 
                     case 2: { // Mayor patrimonio por ciudad
-                        monitor.iniciar_tiempo();
-                        long memoria_busqueda = monitor.medir_memoria_funcion_kb([&]{
+                        medirConsulta("Mayor patrimonio por ciudad", [&]{
                             buscarMayoresPatrimonioPorCiudad(personas);
                         });
-
-                        double tiempo_busqueda = monitor.detener_tiempo();
-                        monitor.mostrar_estadistica("Mayor patrimonio por ciudad", tiempo_busqueda, memoria_busqueda);
-                        monitor.registrar("Mayor patrimonio por ciudad", tiempo_busqueda, memoria_busqueda);
                         break;
                     }
 
                     case 3: { // Mayor patrimonio por grupo de declaración
-                        monitor.iniciar_tiempo();
-                        long memoria_busqueda = monitor.medir_memoria_funcion_kb([&]{
+                        medirConsulta("Mayor patrimonio por grupo", [&]{
                             buscarMayoresPatrimonioPorGrupo(personas);
                         });
-
-                        double tiempo_busqueda = monitor.detener_tiempo();
-                        monitor.mostrar_estadistica("Mayor patrimonio por grupo", tiempo_busqueda, memoria_busqueda);
-                        monitor.registrar("Mayor patrimonio por grupo", tiempo_busqueda, memoria_busqueda);
                         break;
                     }
 
@@ -293,21 +630,17 @@ int main() {
                 std::cin >> listadoGrupos;
                 switch(listadoGrupos) {
                     case 1: {
-                        monitor.iniciar_tiempo();
-                        long memoria_busqueda = monitor.medir_memoria_funcion_kb([&]{
-                            std::cout << "\nIngresar calendario (A-B-C)";
-                            std::cin >> calendario;
+                        // El calendario se lee antes de medir: el proceso hijo no debe consumir la entrada
+                        std::cout << "\nIngresar calendario (A-B-C)";
+                        std::cin >> calendario;
+                        medirConsulta("Listar y contar por calendario especifico", [&]{
                             listarPersonasGrupo(personas,calendario,contador);
                             std::cout << "\nA grupo "<< calendario <<"pertenecen"<< contador << "personas"; 
                         });
-                        double tiempo_busqueda = monitor.detener_tiempo();
-                        monitor.mostrar_estadistica("Listar y contar por calendario especifico", tiempo_busqueda, memoria_busqueda);
-                        monitor.registrar("Listar y contar por calendario especifico", tiempo_busqueda, memoria_busqueda);
                         break;
                     }
                     case 2: {
-                        monitor.iniciar_tiempo();
-                        long memoria_busqueda = monitor.medir_memoria_funcion_kb([&]{
+                        medirConsulta("Listar y contar en todos los calendarios", [&]{
                             listarPersonasGrupo(personas,'A',contador);
                             std::cout << "\nA grupo A pertenecen"<< contador << "personas"; 
                             contador = 0;
@@ -317,26 +650,21 @@ int main() {
                             listarPersonasGrupo(personas,'C',contador);
                             std::cout << "\nA grupo C pertenecen"<< contador << "personas"; 
                         });
-                        double tiempo_busqueda = monitor.detener_tiempo();
-                        monitor.mostrar_estadistica("Listar y contar en todos los calendarios", tiempo_busqueda, memoria_busqueda);
-                        monitor.registrar("Listar y contar en todos los calendarios", tiempo_busqueda, memoria_busqueda);
                         break;
                     }
                     case 3: {
-                        monitor.iniciar_tiempo();
-                        long memoria_busqueda = monitor.medir_memoria_funcion_kb([&]{
-                            std::cout << "\nIngrese el ID a buscar: ";
-                            std::cin >> idBusqueda;
-                            Persona encontrada = buscarPorID(personas, idBusqueda);
-                            if (encontrada.id != "") {
+                        asegurarIndiceID();
+                        // El ID se lee antes de medir: el proceso hijo no debe consumir la entrada
+                        std::cout << "\nIngrese el ID a buscar: ";
+                        std::cin >> idBusqueda;
+                        medirConsulta("Buscar por ID", [&]{
+                            Persona encontrada = buscarPorID(personas, indiceID, idBusqueda);
+                            if (encontrada.id != 0) {
                                 encontrada.mostrar();
                             } else {
                                 std::cout << "No se encontró persona con ID " << idBusqueda << "\n";
                             }
                         });
-                        double tiempo_busqueda = monitor.detener_tiempo();
-                        monitor.mostrar_estadistica("Buscar por ID", tiempo_busqueda, memoria_busqueda);
-                        monitor.registrar("Buscar por ID", tiempo_busqueda, memoria_busqueda);
                         break;
                     }
                     default:
@@ -346,23 +674,15 @@ int main() {
 
     case 8: // Grupo con más personas de una ciudad
     {
-      monitor.iniciar_tiempo();
-      long memoria_busqueda = monitor.medir_memoria_funcion_kb([&]{
+      medirConsulta("Grupo con más personas de una ciudad", [&]{
           calcularGrupoMayorPorCiudad(personas);
       });
-      double tiempo_busqueda = monitor.detener_tiempo();
-      monitor.mostrar_estadistica("Grupo con más personas de una ciudad", tiempo_busqueda, memoria_busqueda);
-      monitor.registrar("Grupo con más personas de una ciudad", tiempo_busqueda, memoria_busqueda);
       break;
     }
     case 9: { // 3 ciudades con patrimonio promedio más alto
-      monitor.iniciar_tiempo();
-      long memoria_busqueda = monitor.medir_memoria_funcion_kb([&]{
+      medirConsulta("Ciudades con patrimonio promedio más alto", [&]{
           calcularPromedioPatrimonio(personas);
       });
-      double tiempo_busqueda = monitor.detener_tiempo();
-      monitor.mostrar_estadistica("Grupo con más personas de una ciudad", tiempo_busqueda, memoria_busqueda);
-      monitor.registrar("Grupo con más personas de una ciudad", tiempo_busqueda, memoria_busqueda);
       break;
     }
     case 10: // Persona con mayor deuda
@@ -379,41 +699,26 @@ int main() {
 
         switch (filtradoPersonaDeuda) {
             case 1: { // Mayor deuda en Colombia
-                monitor.iniciar_tiempo();
-                long memoria_busqueda = monitor.medir_memoria_funcion_kb([&]{
+                medirConsulta("Mayor deuda en Colombia", [&]{
                     Persona p = buscarMayorDeuda(personas);
-                    if (p.id != "") {
+                    if (p.id != 0) {
                         std::cout << "\n=== Persona con mayor deuda en Colombia ===\n";
                     }
                 });
-
-                double tiempo_busqueda = monitor.detener_tiempo();
-                monitor.mostrar_estadistica("Mayor deuda en Colombia", tiempo_busqueda, memoria_busqueda);
-                monitor.registrar("Mayor deuda en Colombia", tiempo_busqueda, memoria_busqueda);
                 break;
             }
 
             case 2: { // Mayor deuda por ciudad
-                monitor.iniciar_tiempo();
-                long memoria_busqueda = monitor.medir_memoria_funcion_kb([&]{
+                medirConsulta("Mayor deuda por ciudad", [&]{
                     buscarMayoresDeudasPorCiudad(personas);
                 });
-
-                double tiempo_busqueda = monitor.detener_tiempo();
-                monitor.mostrar_estadistica("Mayor deuda por ciudad", tiempo_busqueda, memoria_busqueda);
-                monitor.registrar("Mayor deuda por ciudad", tiempo_busqueda, memoria_busqueda);
                 break;
             }
 
             case 3: { // Mayor deuda por grupo de declaración
-                monitor.iniciar_tiempo();
-                long memoria_busqueda = monitor.medir_memoria_funcion_kb([&]{
+                medirConsulta("Mayor deuda por grupo", [&]{
                     buscarMayoresDeudasPorGrupo(personas);
                 });
-
-                double tiempo_busqueda = monitor.detener_tiempo();
-                monitor.mostrar_estadistica("Mayor deuda por grupo", tiempo_busqueda, memoria_busqueda);
-                monitor.registrar("Mayor deuda por grupo", tiempo_busqueda, memoria_busqueda);
                 break;
             }
 
@@ -422,6 +727,409 @@ int main() {
         }
         break;
 
+    case 12: { // Crear conjunto de datos en paralelo
+        int n;
+        unsigned long long semilla;
+        unsigned hilos;
+        std::cout << "\nIngrese el número de personas a generar: ";
+        std::cin >> n;
+        std::cout << "Ingrese la semilla: ";
+        std::cin >> semilla;
+        std::cout << "Ingrese el número de hilos (0 = todos los núcleos): ";
+        std::cin >> hilos;
+
+        if (n <= 0) {
+            std::cout << "Error: Debe generar al menos 1 persona\n";
+            break;
+        }
+
+        monitor.iniciar_tiempo();
+        long memoria_inicio = monitor.obtener_memoria();
+
+        personas = generarColeccionParalela(n, semilla, hilos);
+        columnasVigentes = false;
+        indiceVigente = false;
+
+        double tiempo_gen = monitor.detener_tiempo();
+        long memoria_gen = monitor.obtener_memoria() - memoria_inicio;
+
+        std::cout << "Generadas " << personas.size() << " personas en "
+                  << tiempo_gen << " ms, Memoria: " << memoria_gen << " KB\n";
+
+        monitor.mostrar_estadistica("Crear datos (paralelo)", tiempo_gen, memoria_gen);
+        monitor.registrar("Crear datos (paralelo)", tiempo_gen, memoria_gen);
+        break;
+    }
+
+    case 13: { // Consultas columnares
+        if (personas.empty() && !columnasVigentes) {
+            std::cout << "\nNo hay datos disponibles. Use opción 0 primero.\n";
+            break;
+        }
+
+        asegurarColumnas(); // Una vez por conjunto de datos
+
+        int consultaColumnar;
+        std::cout << "\n1. Mayor patrimonio en todo el país";
+        std::cout << "\n2. Mayor patrimonio por ciudad";
+        std::cout << "\n3. Mayor patrimonio por grupo de declaración";
+        std::cout << "\n4. Mayor deuda en todo el país";
+        std::cout << "\n5. Mayor deuda por ciudad";
+        std::cout << "\n6. Mayor deuda por grupo de declaración";
+        std::cout << "\n7. Persona más longeva en el país";
+        std::cout << "\n8. Persona más longeva por ciudad";
+        std::cout << "\n9. Listar y contar un grupo (A, B o C)";
+        std::cout << "\n10. Grupo con más personas por ciudad";
+        std::cout << "\n11. 3 ciudades con mayor promedio de patrimonio";
+        std::cout << "\n12. Buscar persona por ID";
+        std::cout << "\n13. Reporte completo (opciones 5 a 10 en un solo recorrido)";
+        std::cout << "\n14. Listar y contar un grupo en una ciudad";
+        std::cout << "\n15. Contar personas por grupo y declarantes (sin listar)";
+        std::cout << "\n16. Top K por campo (en total, por ciudad o por grupo)";
+        std::cout << "\n17. Contar o listar personas en un rango de ingresos, patrimonio o deudas";
+        std::cout << "\n18. Persona en un percentil de ingresos, patrimonio o deudas";
+        std::cout << "\n19. Contar personas con deudas sobre una fracción de su patrimonio";
+        std::cout << "\nSeleccione una opción: ";
+        std::cin >> consultaColumnar;
+
+        switch (consultaColumnar) {
+            case 1:
+                medirConsulta("Mayor patrimonio (columnar)", [&]{
+                    std::cout << "\n=== Persona con mayor patrimonio en Colombia ===\n";
+                    mostrarFila(columnas, buscarMayorPatrimonio(columnas));
+                });
+                break;
+            case 2:
+                medirConsulta("Mayor patrimonio por ciudad (columnar)", [&]{
+                    buscarMayoresPatrimonioPorCiudad(columnas);
+                });
+                break;
+            case 3:
+                medirConsulta("Mayor patrimonio por grupo (columnar)", [&]{
+                    buscarMayoresPatrimonioPorGrupo(columnas);
+                });
+                break;
+            case 4:
+                medirConsulta("Mayor deuda (columnar)", [&]{
+                    std::cout << "\n=== Persona con mayor deuda en Colombia ===\n";
+                    mostrarFila(columnas, buscarMayorDeuda(columnas));
+                });
+                break;
+            case 5:
+                medirConsulta("Mayor deuda por ciudad (columnar)", [&]{
+                    buscarMayoresDeudasPorCiudad(columnas);
+                });
+                break;
+            case 6:
+                medirConsulta("Mayor deuda por grupo (columnar)", [&]{
+                    buscarMayoresDeudasPorGrupo(columnas);
+                });
+                break;
+            case 7:
+                medirConsulta("Persona más longeva (columnar)", [&]{
+                    std::cout << "\n=== Persona más longeva en Colombia ===\n";
+                    mostrarFila(columnas, buscarPersonaMasLongevaConCondicion(columnas));
+                });
+                break;
+            case 8:
+                medirConsulta("Persona más longeva por ciudad (columnar)", [&]{
+                    mostrarPersonasMasLongevaPorCiudad(columnas);
+                });
+                break;
+            case 9: {
+                char grupo;
+                std::cout << "\nIngresar grupo (A-B-C): ";
+                std::cin >> grupo;
+                int conteo = 0;
+                asegurarIndiceColumnar(IndiceColumnar::CiudadGrupo);
+                medirConsulta("Listar y contar grupo (columnar)", [&]{
+                    conteo = 0; // La consulta puede repetirse (modo benchmark)
+                    listarPersonasGrupo(columnas, grupo, &conteo);
+                    std::cout << "\nAl grupo " << grupo << " pertenecen " << conteo << " personas\n";
+                });
+                break;
+            }
+            case 10:
+                asegurarIndiceColumnar(IndiceColumnar::CiudadGrupo);
+                medirConsulta("Grupo mayor por ciudad (columnar)", [&]{
+                    calcularGrupoMayorPorCiudad(columnas);
+                });
+                break;
+            case 11:
+                medirConsulta("Promedio patrimonio por ciudad (columnar)", [&]{
+                    calcularPromedioPatrimonio(columnas);
+                });
+                break;
+            case 12: {
+                unsigned long long idNumerico;
+                std::cout << "\nIngrese el ID a buscar: ";
+                if (!(std::cin >> idNumerico)) {
+                    std::cout << "Entrada inválida!\n";
+                    std::cin.clear();
+                    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+                    break;
+                }
+                medirConsulta("Buscar por ID (columnar)", [&]{
+                    size_t fila = buscarPorID(columnas, idNumerico);
+                    if (fila != FILA_INVALIDA) {
+                        mostrarFila(columnas, fila);
+                    } else {
+                        std::cout << "No se encontró persona con ID " << idNumerico << "\n";
+                    }
+                });
+                break;
+            }
+            case 13:
+                medirConsulta("Reporte completo (un recorrido)", [&]{
+                    mostrarReporteCompleto(columnas);
+                });
+                break;
+            case 14: {
+                std::string nombreCiudad;
+                char grupo;
+                std::cout << "\nIngrese la ciudad: ";
+                std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+                std::getline(std::cin, nombreCiudad);
+                std::cout << "Ingresar grupo (A-B-C): ";
+                std::cin >> grupo;
+                CodigoCadena ciudad;
+                if (!diccionarioCiudades().buscar(nombreCiudad, ciudad)) {
+                    std::cout << "Ciudad desconocida: " << nombreCiudad << "\n";
+                    break;
+                }
+                int conteo = 0;
+                asegurarIndiceColumnar(IndiceColumnar::CiudadGrupo);
+                medirConsulta("Listar grupo en ciudad (columnar)", [&]{
+                    conteo = 0; // La consulta puede repetirse (modo benchmark)
+                    listarPersonasCiudadGrupo(columnas, ciudad, grupo, &conteo);
+                    std::cout << "\nAl grupo " << grupo << " en " << nombreCiudad << " pertenecen " << conteo << " personas\n";
+                });
+                break;
+            }
+            case 15:
+                asegurarIndiceColumnar(IndiceColumnar::MapasBits);
+                medirConsulta("Contar por grupo (mapas de bits)", [&]{
+                    mostrarConteoPorGrupo(columnas);
+                });
+                break;
+            case 16: {
+                unsigned long long k;
+                int campo, agrupacion;
+                std::cout << "\nCantidad K: ";
+                std::cin >> k;
+                std::cout << "Campo (1. Ingresos, 2. Patrimonio, 3. Deudas, 4. Más longevas): ";
+                std::cin >> campo;
+                std::cout << "Agrupar (0. Total, 1. Ciudad, 2. Grupo, 3. Ciudad y grupo): ";
+                std::cin >> agrupacion;
+                if (!std::cin || k == 0 || campo < 1 || campo > 4 || agrupacion < 0 || agrupacion > 3) {
+                    std::cout << "Entrada inválida!\n";
+                    std::cin.clear();
+                    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+                    break;
+                }
+                const CampoAgregado campoTopK = static_cast<CampoAgregado>(campo - 1);
+                const AgrupacionAgregado agrupacionTopK = static_cast<AgrupacionAgregado>(agrupacion);
+                medirConsulta("Top K (columnar)", [&]{
+                    mostrarTopK(columnas, calcularTopK(columnas, campoTopK, agrupacionTopK, static_cast<size_t>(k)));
+                });
+                break;
+            }
+            case 17: {
+                int campo, modo;
+                double minimo, maximo;
+                std::cout << "\nCampo (1. Ingresos, 2. Patrimonio, 3. Deudas): ";
+                std::cin >> campo;
+                std::cout << "Valor mínimo: ";
+                std::cin >> minimo;
+                std::cout << "Valor máximo: ";
+                std::cin >> maximo;
+                std::cout << "1. Solo contar, 2. Listar: ";
+                std::cin >> modo;
+                if (!std::cin || campo < 1 || campo > 3 || modo < 1 || modo > 2) {
+                    std::cout << "Entrada inválida!\n";
+                    std::cin.clear();
+                    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+                    break;
+                }
+                const CampoAgregado campoRango = static_cast<CampoAgregado>(campo - 1);
+                asegurarIndiceColumnar(indiceRangoDeCampo(campoRango));
+                if (modo == 1) {
+                    medirConsulta("Contar rango (índice de rango)", [&]{
+                        std::cout << "\nEn el rango hay " << contarEnRango(columnas, campoRango, minimo, maximo) << " personas\n";
+                    });
+                } else {
+                    medirConsulta("Listar rango (índice de rango)", [&]{
+                        const size_t listadas = listarEnRango(columnas, campoRango, minimo, maximo);
+                        std::cout << "\nEn el rango hay " << listadas << " personas\n";
+                    });
+                }
+                break;
+            }
+            case 18: {
+                int campo;
+                double percentil;
+                std::cout << "\nCampo (1. Ingresos, 2. Patrimonio, 3. Deudas): ";
+                std::cin >> campo;
+                std::cout << "Percentil (0-100): ";
+                std::cin >> percentil;
+                if (!std::cin || campo < 1 || campo > 3 || percentil < 0 || percentil > 100) {
+                    std::cout << "Entrada inválida!\n";
+                    std::cin.clear();
+                    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+                    break;
+                }
+                const CampoAgregado campoPercentil = static_cast<CampoAgregado>(campo - 1);
+                asegurarIndiceColumnar(indiceRangoDeCampo(campoPercentil));
+                medirConsulta("Percentil (índice de rango)", [&]{
+                    std::cout << "\n=== Percentil " << percentil << " ===\n";
+                    mostrarFila(columnas, filaPercentil(columnas, campoPercentil, percentil));
+                });
+                break;
+            }
+            case 19: {
+                double fraccion;
+                std::cout << "\nFracción del patrimonio (p. ej. 0.7 = 70%): ";
+                std::cin >> fraccion;
+                if (!std::cin || fraccion < 0) {
+                    std::cout << "Entrada inválida!\n";
+                    std::cin.clear();
+                    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+                    break;
+                }
+                medirConsulta("Deudas sobre patrimonio (columnar)", [&]{
+                    std::cout << "\nPersonas con deudas mayores al " << fraccion * 100 << "% de su patrimonio: "
+                              << contarDeudaSobrePatrimonio(columnas, fraccion) << "\n";
+                });
+                break;
+            }
+            default:
+                std::cout << "Opción inválida!\n";
+        }
+        break;
+    }
+
+    case 14: { // Guardar instantánea binaria
+        asegurarColumnas();
+        if (!columnasVigentes) {
+            std::cout << "\nNo hay datos disponibles. Use opción 0 primero.\n";
+            break;
+        }
+        std::string ruta;
+        std::cout << "\nIngrese la ruta del archivo: ";
+        std::cin >> ruta;
+
+        monitor.iniciar_tiempo();
+        long memoria_inicio = monitor.obtener_memoria();
+        if (guardarInstantanea(columnas, ruta)) {
+            std::cout << "Instantánea guardada: " << columnas.size() << " personas en " << ruta << "\n";
+        }
+        double tiempo_guardar = monitor.detener_tiempo();
+        long memoria_guardar = monitor.obtener_memoria() - memoria_inicio;
+        monitor.mostrar_estadistica("Guardar instantánea", tiempo_guardar, memoria_guardar);
+        monitor.registrar("Guardar instantánea", tiempo_guardar, memoria_guardar);
+        break;
+    }
+
+    case 15: { // Cargar instantánea binaria
+        std::string ruta;
+        std::cout << "\nIngrese la ruta del archivo: ";
+        std::cin >> ruta;
+
+        monitor.iniciar_tiempo();
+        long memoria_inicio = monitor.obtener_memoria();
+        if (cargarInstantanea(ruta, columnas)) {
+            // Las columnas son ahora el conjunto de datos; las filas se reconstruyen al usarlas
+            personas.clear();
+            columnasVigentes = true;
+            indiceVigente = false;
+            std::cout << "Instantánea cargada: " << columnas.size() << " personas desde " << ruta << "\n";
+        }
+        double tiempo_cargar = monitor.detener_tiempo();
+        long memoria_cargar = monitor.obtener_memoria() - memoria_inicio;
+        monitor.mostrar_estadistica("Cargar instantánea", tiempo_cargar, memoria_cargar);
+        monitor.registrar("Cargar instantánea", tiempo_cargar, memoria_cargar);
+        break;
+    }
+
+    case 16: // Contadores de hardware en las mediciones siguientes
+        if (monitor.contadores_activos()) {
+            monitor.desactivar_contadores();
+            std::cout << "\nContadores de hardware desactivados.\n";
+        } else if (monitor.activar_contadores()) {
+            std::cout << "\nContadores de hardware activos: se mostrarán con cada medición.\n";
+        } else {
+            std::cout << "\nNo hay contadores de hardware disponibles; se sigue midiendo tiempo y memoria.\n";
+        }
+        break;
+
+    case 17: { // Modo benchmark para las consultas de las opciones 5 a 10 y 13
+        int repeticiones, calentamiento;
+        std::cout << "\nRepeticiones medidas por consulta (0 o 1 = desactivar): ";
+        std::cin >> repeticiones;
+        std::cout << "Ejecuciones de calentamiento sin medir: ";
+        std::cin >> calentamiento;
+        if (!std::cin) {
+            std::cout << "Entrada inválida!\n";
+            std::cin.clear();
+            std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+            break;
+        }
+        monitor.configurar_repeticiones(repeticiones, calentamiento);
+        if (monitor.repeticiones() > 0) {
+            std::cout << "Modo benchmark activo: " << monitor.repeticiones() << " repeticiones por consulta.\n";
+        } else {
+            std::cout << "Modo benchmark desactivado.\n";
+        }
+        break;
+    }
+
+    case 18: { // Estadísticas en flujo: generar y agregar sin guardar las personas
+        unsigned long long n, semilla;
+        unsigned hilos;
+        std::cout << "\nIngrese el número de personas a generar (no se guardan): ";
+        std::cin >> n;
+        std::cout << "Ingrese la semilla: ";
+        std::cin >> semilla;
+        std::cout << "Ingrese el número de hilos (0 = todos los núcleos): ";
+        std::cin >> hilos;
+        if (!std::cin || n == 0) {
+            std::cout << "Entrada inválida!\n";
+            std::cin.clear();
+            std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+            break;
+        }
+
+        monitor.iniciar_tiempo();
+        monitor.iniciar_memoria_pico();
+        AgregadoEnFlujo agregado = generarYAgregar(n, semilla, hilos);
+        double tiempo_flujo = monitor.detener_tiempo();
+        long memoria_flujo = monitor.memoria_pico_delta_kb();
+
+        mostrarAgregadoEnFlujo(agregado);
+        monitor.mostrar_estadistica("Estadísticas en flujo", tiempo_flujo, memoria_flujo);
+        monitor.registrar("Estadísticas en flujo", tiempo_flujo, memoria_flujo);
+        break;
+    }
+
+    case 19: { // Hilos para los listados
+        unsigned hilos;
+        std::cout << "\nHilos para formatear los listados (1 = secuencial, 0 = todos los núcleos): ";
+        std::cin >> hilos;
+        if (!std::cin || hilos > MAXIMO_HILOS_SALIDA) {
+            std::cout << "Entrada inválida!\n";
+            std::cin.clear();
+            std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+            break;
+        }
+        fijarHilosSalida(hilos);
+        if (hilosSalida() == 1) {
+            std::cout << "Listados secuenciales.\n";
+        } else {
+            std::cout << "Listados en paralelo con " << hilosEfectivos(hilosSalida()) << " hilos.\n";
+        }
+        break;
+    }
+
     case 11: // Salida
       std::cout << "Saliendo...\n";
       break;
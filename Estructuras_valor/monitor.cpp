@@ -1,12 +1,22 @@
 #include "monitor.h"
+#include "salida.h"         // escribirTodo
 
 #include <unistd.h>         // sysconf, fork, _exit
-#include <cstdio>           // FILE, fscanf, perror
+#include <cstdio>           // FILE, fscanf, perror, snprintf
 #include <sys/resource.h>   // getrusage, rusage
 #include <sys/wait.h>       // wait4
-#include <algorithm>        // std::max
+#include <algorithm>        // std::max, std::sort
+#include <cmath>            // std::sqrt, std::ceil
+#include <fcntl.h>          // open
 #include <iostream>         // std::cout, std::cerr
 #include <fstream>          // std::ofstream
+#include <cerrno>
+#include <cstring>          // std::memset, std::memcpy, std::strerror
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>    // SYS_perf_event_open
+#endif
 
 // --- helper: ru_maxrss en KB ---
 namespace {
@@ -19,16 +29,151 @@ namespace {
         return static_cast<long>(u.ru_maxrss / 1024); // Otros: bytes -> KB
     #endif
     }
+
+#if defined(__linux__)
+    // Evento de perf de cada contador, en el orden de NOMBRES_CONTADORES
+    struct EventoPerf {
+        uint32_t tipo;
+        uint64_t config;
+    };
+
+    uint64_t cache_(uint64_t cache) {
+        return cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    }
+
+    const EventoPerf EVENTOS[Monitor::NUM_CONTADORES] = {
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+        {PERF_TYPE_HW_CACHE, cache_(PERF_COUNT_HW_CACHE_L1D)},
+        {PERF_TYPE_HW_CACHE, cache_(PERF_COUNT_HW_CACHE_LL)},
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+        {PERF_TYPE_HW_CACHE, cache_(PERF_COUNT_HW_CACHE_DTLB)},
+    };
+
+    int abrir_evento_(const EventoPerf& evento) {
+        perf_event_attr atributos;
+        std::memset(&atributos, 0, sizeof(atributos));
+        atributos.size = sizeof(atributos);
+        atributos.type = evento.tipo;
+        atributos.config = evento.config;
+        atributos.disabled = 1;       // Se habilita en iniciar_tiempo()
+        atributos.inherit = 1;        // Cuenta también hilos y procesos hijos (medir_memoria_funcion_kb)
+        atributos.exclude_kernel = 1; // Permitido con perf_event_paranoid <= 2
+        atributos.exclude_hv = 1;
+        atributos.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        return static_cast<int>(syscall(SYS_perf_event_open, &atributos, 0, -1, -1, PERF_FLAG_FD_CLOEXEC));
+    }
+#endif
+}
+
+const char* const Monitor::NOMBRES_CONTADORES[Monitor::NUM_CONTADORES] = {
+    "Ciclos", "Instrucciones", "FallosL1d", "FallosLLC", "FallosRama", "FallosDTLB"
+};
+
+Monitor::Monitor() {
+    for (int k = 0; k < NUM_CONTADORES; ++k) {
+        fds_contadores_[k] = -1;
+        ultimos_contadores_[k] = -1;
+    }
+}
+
+Monitor::~Monitor() {
+    desactivar_contadores();
+}
+
+/**
+ * Abre los contadores de hardware para las siguientes mediciones.
+ *
+ * POR QUÉ: Comparar las variantes (clases/structs, valor/apuntadores) por su uso de la
+ *          caché, no solo por el tiempo total.
+ * CÓMO: Un descriptor de perf_event_open por contador, solo espacio de usuario y con
+ *       'inherit' para sumar lo que cuenten los hilos y el proceso hijo de
+ *       medir_memoria_funcion_kb. Cada contador que el núcleo rechace (sin PMU en una
+ *       máquina virtual, perf_event_paranoid alto, etc.) queda como no disponible.
+ * PARA QUÉ: Registrar ciclos, instrucciones y fallos junto al tiempo de cada operación.
+ * @return true si al menos un contador quedó abierto.
+ */
+bool Monitor::activar_contadores() {
+#if defined(__linux__)
+    desactivar_contadores();
+    int abiertos = 0;
+    for (int k = 0; k < NUM_CONTADORES; ++k) {
+        fds_contadores_[k] = abrir_evento_(EVENTOS[k]);
+        if (fds_contadores_[k] >= 0) {
+            ++abiertos;
+        } else {
+            std::cerr << "[monitor] Contador " << NOMBRES_CONTADORES[k] << " no disponible: "
+                      << std::strerror(errno) << "\n";
+        }
+    }
+    contadores_activos_ = abiertos > 0;
+    if (!contadores_activos_) {
+        std::cerr << "[monitor] Sin contadores de hardware (revise /proc/sys/kernel/perf_event_paranoid"
+                     " o si la máquina expone la PMU)\n";
+    }
+    return contadores_activos_;
+#else
+    std::cerr << "[monitor] Los contadores de hardware solo están disponibles en Linux\n";
+    return false;
+#endif
+}
+
+void Monitor::desactivar_contadores() {
+    for (int k = 0; k < NUM_CONTADORES; ++k) {
+        if (fds_contadores_[k] >= 0) close(fds_contadores_[k]);
+        fds_contadores_[k] = -1;
+        ultimos_contadores_[k] = -1;
+    }
+    contadores_activos_ = false;
+}
+
+/**
+ * Detiene los contadores y guarda en 'ultimos_contadores_' lo contado desde iniciar_tiempo().
+ *
+ * Si el núcleo multiplexó el contador (más eventos que registros de la PMU), el valor
+ * se escala por tiempo habilitado / tiempo contando, como hace 'perf stat'.
+ */
+void Monitor::leer_contadores() {
+#if defined(__linux__)
+    for (int k = 0; k < NUM_CONTADORES; ++k) {
+        ultimos_contadores_[k] = -1;
+        if (fds_contadores_[k] < 0) continue;
+        ioctl(fds_contadores_[k], PERF_EVENT_IOC_DISABLE, 0);
+        uint64_t lectura[3]; // valor, tiempo habilitado, tiempo contando
+        if (read(fds_contadores_[k], lectura, sizeof(lectura)) != static_cast<ssize_t>(sizeof(lectura))) continue;
+        for (int campo = 0; campo < 3; ++campo) lectura[campo] -= base_contadores_[k][campo];
+        if (lectura[2] == 0) continue; // Nunca llegó a contar
+        double valor = static_cast<double>(lectura[0]);
+        if (lectura[2] < lectura[1]) valor *= static_cast<double>(lectura[1]) / static_cast<double>(lectura[2]);
+        ultimos_contadores_[k] = static_cast<long long>(valor);
+    }
+#endif
 }
 
 /**
  * Inicia el cronómetro.
  * 
  * POR QUÉ: Comenzar a medir el tiempo de una operación.
- * CÓMO: Guardando el tiempo actual en 'inicio'.
+ * CÓMO: Guardando el tiempo actual en 'inicio' (y leyendo y habilitando los contadores
+ *       de hardware, si están activos).
  * PARA QUÉ: Poder calcular la duración después.
  */
 void Monitor::iniciar_tiempo() {
+#if defined(__linux__)
+    for (int k = 0; k < NUM_CONTADORES; ++k) {
+        ultimos_contadores_[k] = -1;
+        if (fds_contadores_[k] < 0) continue;
+        // Lectura inicial en vez de PERF_EVENT_IOC_RESET: el reinicio no borra lo que
+        // ya sumaron los hijos terminados, así que se mide la diferencia
+        if (read(fds_contadores_[k], base_contadores_[k], sizeof(base_contadores_[k])) !=
+            static_cast<ssize_t>(sizeof(base_contadores_[k]))) continue;
+        ioctl(fds_contadores_[k], PERF_EVENT_IOC_ENABLE, 0);
+    }
+#endif
+    if (INSTRUMENTACION_ACTIVA) {
+        base_instrumentacion_ = leerInstrumentacion();
+        instrumentacion_hijos_ = ConteoInstrumentacion();
+    }
     inicio = std::chrono::high_resolution_clock::now();
 }
 
@@ -36,12 +181,19 @@ void Monitor::iniciar_tiempo() {
  * Detiene el cronómetro y devuelve el tiempo transcurrido.
  * 
  * POR QUÉ: Obtener la duración de una operación.
- * CÓMO: Calculando la diferencia entre el tiempo actual y 'inicio'.
+ * CÓMO: Calculando la diferencia entre el tiempo actual y 'inicio'; si hay contadores
+ *       activos, los detiene y guarda su lectura para registrar()/mostrar_estadistica(),
+ *       igual que las copias y reservas en la compilación instrumentada.
  * PARA QUÉ: Conocer el tiempo que tomó una operación.
  * @return Tiempo en milisegundos con decimales.
  */
 double Monitor::detener_tiempo() {
     auto fin = std::chrono::high_resolution_clock::now();
+    if (contadores_activos_) leer_contadores();
+    if (INSTRUMENTACION_ACTIVA) {
+        ultima_instrumentacion_ = leerInstrumentacion() - base_instrumentacion_;
+        ultima_instrumentacion_ += instrumentacion_hijos_;
+    }
     std::chrono::duration<double, std::milli> duracion = fin - inicio;
     return duracion.count();
 }
@@ -95,19 +247,68 @@ long Monitor::memoria_pico_delta_kb() const {
 
 // ======= Medir memoria por función (proceso hijo) =======
 long Monitor::medir_memoria_funcion_kb(const std::function<void()>& fn) {
+    std::string ignorado;
+    return medir_memoria_funcion_kb([&fn]{ fn(); return std::string(); }, ignorado);
+}
+
+// Lo que la consulta calcula en el hijo se pierde con él, así que vuelve al padre por una
+// tubería: primero, en la compilación instrumentada, lo que contó (que detener_tiempo()
+// suma a la medición en curso) y después el texto de 'resultado', hasta el fin de la tubería
+long Monitor::medir_memoria_funcion_kb(const std::function<std::string()>& fn, std::string& resultado) {
+    resultado.clear();
+    int tuberia[2] = {-1, -1};
+    if (pipe(tuberia) != 0) tuberia[0] = tuberia[1] = -1;
+
+    // Vaciar antes de fork: si no, el hijo hereda y vuelve a escribir lo pendiente
+    std::cout.flush();
+    std::fflush(stdout);
     pid_t pid = fork();
     if (pid < 0) {
         std::cerr << "fork() falló\n";
+        if (tuberia[0] >= 0) { close(tuberia[0]); close(tuberia[1]); }
         return 0;
     }
 
     if (pid == 0) {
         // --- Proceso hijo ---
-        try { fn(); } catch (...) { /* no propagar al padre */ }
+        const ConteoInstrumentacion antes = leerInstrumentacion();
+        std::string texto;
+        try { texto = fn(); } catch (...) { /* no propagar al padre */ }
+        if (tuberia[1] >= 0) {
+            if (INSTRUMENTACION_ACTIVA) {
+                const ConteoInstrumentacion conteo = leerInstrumentacion() - antes;
+                escribirTodo(tuberia[1], reinterpret_cast<const char*>(&conteo), sizeof(conteo));
+            }
+            escribirTodo(tuberia[1], texto.data(), texto.size());
+        }
+        std::cout.flush();
+        std::fflush(stdout); // _exit no vacía stdio; sin esto se pierde la salida redirigida a un archivo o tubería
         _exit(0); // terminar el hijo inmediatamente
     }
 
     // --- Proceso padre ---
+    if (tuberia[0] >= 0) {
+        close(tuberia[1]);
+        char buffer[4096];
+        std::string recibido;
+        ssize_t leidos;
+        while ((leidos = read(tuberia[0], buffer, sizeof(buffer))) != 0) {
+            if (leidos < 0) {
+                if (errno == EINTR) continue;
+                break;
+            }
+            recibido.append(buffer, static_cast<size_t>(leidos));
+        }
+        close(tuberia[0]);
+        size_t inicioTexto = 0;
+        if (INSTRUMENTACION_ACTIVA && recibido.size() >= sizeof(ConteoInstrumentacion)) {
+            ConteoInstrumentacion conteo;
+            std::memcpy(&conteo, recibido.data(), sizeof(conteo));
+            instrumentacion_hijos_ += conteo;
+            inicioTexto = sizeof(conteo);
+        }
+        resultado = recibido.substr(inicioTexto);
+    }
     int status = 0;
     rusage ru{};
     if (wait4(pid, &status, 0, &ru) == -1) {
@@ -122,8 +323,135 @@ long Monitor::medir_memoria_funcion_kb(const std::function<void()>& fn) {
 #endif
 }
 
+namespace {
+    // Resumen de una serie de tiempos; percentiles por rango más cercano
+    struct Percentiles {
+        double minimo, mediana, p90, p99, maximo, desviacion;
+    };
+
+    Percentiles calcular_percentiles_(std::vector<double> muestras) {
+        std::sort(muestras.begin(), muestras.end());
+        const size_t n = muestras.size();
+        auto percentil = [&](double p) {
+            size_t rango = static_cast<size_t>(std::ceil(p * static_cast<double>(n)));
+            return muestras[rango == 0 ? 0 : rango - 1];
+        };
+        double suma = 0;
+        for (double m : muestras) suma += m;
+        const double media = suma / static_cast<double>(n);
+        double cuadrados = 0;
+        for (double m : muestras) cuadrados += (m - media) * (m - media);
+        const double desviacion = n > 1 ? std::sqrt(cuadrados / static_cast<double>(n - 1)) : 0.0;
+        return {muestras.front(), percentil(0.5), percentil(0.9), percentil(0.99), muestras.back(), desviacion};
+    }
+
+    // "N=20 min/mediana/p90/p99/max: ... ms, desv: ... ms"
+    std::string texto_percentiles_(const std::vector<double>& muestras) {
+        const Percentiles p = calcular_percentiles_(muestras);
+        char texto[200];
+        std::snprintf(texto, sizeof(texto), "N=%zu min/mediana/p90/p99/max: %.4f/%.4f/%.4f/%.4f/%.4f ms, desv: %.4f ms",
+                      muestras.size(), p.minimo, p.mediana, p.p90, p.p99, p.maximo, p.desviacion);
+        return texto;
+    }
+
+    // "Ciclos: 123, Instrucciones: 456 (IPC 3.71), ..." o "" si no hay ninguna lectura
+    std::string texto_contadores_(const long long contadores[Monitor::NUM_CONTADORES]) {
+        std::string texto;
+        for (int k = 0; k < Monitor::NUM_CONTADORES; ++k) {
+            if (contadores[k] < 0) continue;
+            if (!texto.empty()) texto += ", ";
+            texto += std::string(Monitor::NOMBRES_CONTADORES[k]) + ": " + std::to_string(contadores[k]);
+            if (k == 1 && contadores[0] > 0) { // Instrucciones por ciclo
+                char ipc[32];
+                std::snprintf(ipc, sizeof(ipc), " (IPC %.2f)", static_cast<double>(contadores[1]) / contadores[0]);
+                texto += ipc;
+            }
+        }
+        return texto;
+    }
+}
+
+void Monitor::configurar_repeticiones(int repeticiones, int calentamiento) {
+    repeticiones_ = repeticiones > 1 ? repeticiones : 0;
+    calentamiento_ = calentamiento > 0 ? calentamiento : 0;
+}
+
+/**
+ * Ejecuta una consulta varias veces y registra la serie completa de tiempos.
+ *
+ * POR QUÉ: Una sola medición está dominada por el ruido (caché fría, planificador,
+ *          frecuencia de la CPU); para comparar variantes hacen falta distribuciones.
+ * CÓMO: 'calentamiento_' ejecuciones sin medir y luego 'repeticiones_' medidas, cada una
+ *       con iniciar_tiempo()/detener_tiempo(), en este mismo proceso (sin fork, para no
+ *       medir la copia de páginas) y con la salida estándar redirigida a /dev/null para
+ *       que los listados no se impriman N veces. Los contadores de hardware, si están
+ *       activos, se promedian por repetición. El registro guarda todas las muestras y
+ *       usa la mediana como su tiempo.
+ * PARA QUÉ: Reportar mínimo, mediana, p90, p99, máximo y desviación por operación en
+ *           mostrar_resumen() y exportar_csv().
+ * @return Mediana de las repeticiones en milisegundos.
+ */
+double Monitor::medir_repeticiones(const std::string& operacion, const std::function<void()>& fn) {
+    const int repeticiones = repeticiones_ > 0 ? repeticiones_ : 1;
+    std::cout.flush();
+    std::fflush(stdout);
+    const int salida_original = dup(STDOUT_FILENO);
+    const int nulo = open("/dev/null", O_WRONLY);
+    if (salida_original >= 0 && nulo >= 0) dup2(nulo, STDOUT_FILENO);
+    if (nulo >= 0) close(nulo);
+
+    const long memoria_inicio = obtener_memoria();
+    for (int i = 0; i < calentamiento_; ++i) fn();
+
+    std::vector<double> muestras;
+    muestras.reserve(static_cast<size_t>(repeticiones));
+    long long sumas[NUM_CONTADORES] = {};
+    bool completos[NUM_CONTADORES];
+    for (int k = 0; k < NUM_CONTADORES; ++k) completos[k] = true;
+    ConteoInstrumentacion instrumentacion;
+    for (int i = 0; i < repeticiones; ++i) {
+        iniciar_tiempo();
+        fn();
+        muestras.push_back(detener_tiempo());
+        instrumentacion += ultima_instrumentacion_;
+        for (int k = 0; k < NUM_CONTADORES; ++k) {
+            if (ultimos_contadores_[k] < 0) completos[k] = false;
+            else sumas[k] += ultimos_contadores_[k];
+        }
+    }
+    const long memoria = obtener_memoria() - memoria_inicio;
+
+    std::cout.flush();
+    std::fflush(stdout);
+    if (salida_original >= 0) {
+        dup2(salida_original, STDOUT_FILENO);
+        close(salida_original);
+    }
+
+    for (int k = 0; k < NUM_CONTADORES; ++k) ultimos_contadores_[k] = completos[k] ? sumas[k] / repeticiones : -1;
+    for (int k = 0; k < NUM_INSTRUMENTOS; ++k) instrumentacion.valores[k] /= static_cast<unsigned>(repeticiones);
+    ultima_instrumentacion_ = instrumentacion;
+    const double mediana = calcular_percentiles_(muestras).mediana;
+    std::cout << "\n[BENCHMARK] " << operacion << " (calentamiento: " << calentamiento_ << ") - "
+              << texto_percentiles_(muestras) << ", Memoria: " << memoria << " KB\n";
+    const std::string contadores = texto_contadores_(ultimos_contadores_);
+    if (!contadores.empty()) std::cout << "[CONTADORES] " << contadores << " (promedio por repetición)\n";
+    if (INSTRUMENTACION_ACTIVA) {
+        std::cout << "[INSTRUMENTACIÓN] " << textoInstrumentacion(instrumentacion) << " (promedio por repetición)\n";
+    }
+
+    Registro registro{operacion, mediana, memoria, {}, std::move(muestras), instrumentacion};
+    for (int k = 0; k < NUM_CONTADORES; ++k) registro.contadores[k] = ultimos_contadores_[k];
+    for (double m : registro.muestras) total_tiempo += m; // El total incluye todas las repeticiones
+    if (memoria > max_memoria) max_memoria = memoria;
+    registros.push_back(std::move(registro));
+    return mediana;
+}
+
 void Monitor::registrar(const std::string& operacion, double tiempo, long memoria) {
-    registros.push_back({operacion, tiempo, memoria});
+    Registro registro{operacion, tiempo, memoria, {}, {}, ultima_instrumentacion_};
+    for (int k = 0; k < NUM_CONTADORES; ++k) registro.contadores[k] = ultimos_contadores_[k];
+    registros.push_back(registro);
     total_tiempo += tiempo;
     if (memoria > max_memoria) {
         max_memoria = memoria;
@@ -141,6 +469,9 @@ void Monitor::mostrar_estadistica(const std::string& operacion, double tiempo, l
     std::cout << "\n[ESTADÍSTICAS] " << operacion << " - "
               << "Tiempo: " << tiempo << " ms, "
               << "Memoria: " << memoria << " KB\n";
+    const std::string contadores = texto_contadores_(ultimos_contadores_);
+    if (!contadores.empty()) std::cout << "[CONTADORES] " << contadores << "\n";
+    if (INSTRUMENTACION_ACTIVA) std::cout << "[INSTRUMENTACIÓN] " << textoInstrumentacion(ultima_instrumentacion_) << "\n";
 }
 
 /**
@@ -155,6 +486,10 @@ void Monitor::mostrar_resumen() {
     for (const auto& reg : registros) {
         std::cout << "\n" << reg.operacion << ": "
                   << reg.tiempo << " ms, " << reg.memoria << " KB";
+        if (!reg.muestras.empty()) std::cout << " (mediana) | " << texto_percentiles_(reg.muestras);
+        const std::string contadores = texto_contadores_(reg.contadores);
+        if (!contadores.empty()) std::cout << " | " << contadores;
+        if (INSTRUMENTACION_ACTIVA) std::cout << " | " << textoInstrumentacion(reg.instrumentacion);
     }
     std::cout << "\nTotal tiempo: " << total_tiempo << " ms";
     std::cout << "\nMemoria máxima: " << max_memoria << " KB\n";
@@ -164,20 +499,49 @@ void Monitor::mostrar_resumen() {
  * Exporta las estadísticas a un archivo CSV.
  * 
  * POR QUÉ: Permitir análisis con herramientas externas (Excel, Python, etc.).
- * CÓMO: Escribiendo en un archivo de texto con formato CSV.
+ * CÓMO: Escribiendo en un archivo de texto con formato CSV; una columna por métrica de
+ *       instrumentación (vacía si no es la compilación instrumentada) y por contador de
+ *       hardware (vacía cuando el contador no estuvo disponible), y los percentiles y
+ *       las muestras (separadas por ';') de las operaciones medidas con repeticiones.
  * PARA QUÉ: Generar reportes y gráficos.
  * @param nombre_archivo Nombre del archivo CSV (por defecto "estadisticas.csv")
+ * @return false si no se pudo abrir o escribir el archivo.
  */
-void Monitor::exportar_csv(const std::string& nombre_archivo) {
+bool Monitor::exportar_csv(const std::string& nombre_archivo) {
     std::ofstream archivo(nombre_archivo);
     if (!archivo) {
         std::cerr << "Error al abrir archivo: " << nombre_archivo << std::endl;
-        return;
+        return false;
     }
-    archivo << "Operacion,Tiempo(ms),Memoria(KB)\n";
+    archivo << "Operacion,Tiempo(ms),Memoria(KB)";
+    for (int k = 0; k < NUM_INSTRUMENTOS; ++k) archivo << "," << NOMBRES_INSTRUMENTOS[k];
+    for (int k = 0; k < NUM_CONTADORES; ++k) archivo << "," << NOMBRES_CONTADORES[k];
+    archivo << ",Repeticiones,Min(ms),Mediana(ms),P90(ms),P99(ms),Max(ms),Desviacion(ms),Muestras(ms)\n";
     for (const auto& reg : registros) {
-        archivo << reg.operacion << "," << reg.tiempo << "," << reg.memoria << "\n";
+        archivo << reg.operacion << "," << reg.tiempo << "," << reg.memoria;
+        for (int k = 0; k < NUM_INSTRUMENTOS; ++k) {
+            archivo << ",";
+            if (INSTRUMENTACION_ACTIVA) archivo << reg.instrumentacion.valores[k];
+        }
+        for (int k = 0; k < NUM_CONTADORES; ++k) {
+            archivo << ",";
+            if (reg.contadores[k] >= 0) archivo << reg.contadores[k]; // Vacío = no disponible
+        }
+        if (reg.muestras.empty()) {
+            archivo << ",1,,,,,,,"; // Medición única: su tiempo está en Tiempo(ms)
+        } else {
+            const Percentiles p = calcular_percentiles_(reg.muestras);
+            archivo << "," << reg.muestras.size() << "," << p.minimo << "," << p.mediana << "," << p.p90
+                    << "," << p.p99 << "," << p.maximo << "," << p.desviacion << ",";
+            for (size_t i = 0; i < reg.muestras.size(); ++i) archivo << (i ? ";" : "") << reg.muestras[i];
+        }
+        archivo << "\n";
     }
     archivo.close();
+    if (!archivo) {
+        std::cerr << "Error al escribir archivo: " << nombre_archivo << std::endl;
+        return false;
+    }
     std::cout << "Estadísticas exportadas a " << nombre_archivo << "\n";
+    return true;
 }
\ No newline at end of file
@@ -1,18 +1,25 @@
 #ifndef PERSONA_H
 #define PERSONA_H
 
+#include "arena.h"
+#include "diccionario.h"
+#include "fecha.h"
+#include "instrumentacion.h"
+#include "salida.h"
+#include <cstdint>
 #include <string>
+#include <vector>
 #include <iostream>
 #include <iomanip>
 
 // Estructura que representa una persona con datos personales y fiscales
 struct Persona {
     // Datos básicos de identificación
-    std::string nombre;           // Nombre de pila
-    std::string apellido;         // Apellidos
-    std::string id;               // Identificador único
-    std::string ciudadNacimiento; // Ciudad de nacimiento en Colombia
-    std::string fechaNacimiento;  // Fecha en formato DD/MM/AAAA
+    CodigoCadena nombre;          // Nombre de pila (código en diccionarioNombres())
+    CodigoCadena apellido;        // Apellidos (código en diccionarioApellidos())
+    uint64_t id;                  // Identificador único (cédula numérica)
+    CodigoCadena ciudadNacimiento; // Ciudad de nacimiento (código en diccionarioCiudades())
+    FechaAAAAMMDD fechaNacimiento; // Fecha como entero AAAAMMDD
     
     // Datos fiscales y económicos
     double ingresosAnuales;       // Ingresos anuales en pesos colombianos
@@ -20,18 +27,31 @@ struct Persona {
     double deudas;                // Deudas pendientes
     bool declaranteRenta;         // Si está obligado a declarar renta
     char grupoDeclaracion;        // Grupo de declaración fiscal (A, B, C)
+#ifdef INSTRUMENTAR
+    InstrumentoCopias instrumento{}; // Cuenta copias y movimientos (ver instrumentacion.h)
+#endif
+
+    // --- Textos resueltos en los diccionarios y fecha formateada (solo para imprimir) ---
+    const std::string& textoNombre() const { return diccionarioNombres().texto(nombre); }
+    const std::string& textoApellido() const { return diccionarioApellidos().texto(apellido); }
+    const std::string& textoCiudad() const { return diccionarioCiudades().texto(ciudadNacimiento); }
+    std::string textoFecha() const { return formatearFecha(fechaNacimiento); }
 
     // --- Métodos de visualización ---
     void mostrar() const;         // Muestra todos los detalles completos
     void mostrarResumen() const;  // Muestra versión compacta para listados
+    void formatearResumen(BufferTexto& salida) const; // El mismo resumen en un búfer (sin std::cout)
 };
 
+// Colección de personas de un conjunto de datos; su memoria vive en una arena propia (ver arena.h)
+typedef std::vector<Persona, AsignadorArena<Persona>> ColeccionPersonas;
+
 // Implementación de métodos inline para mantener la estructura simple
 inline void Persona::mostrar() const {
     std::cout << "-------------------------------------\n";
-    std::cout << "[" << id << "] Nombre: " << nombre << " " << apellido << "\n";
-    std::cout << "   - Ciudad de nacimiento: " << ciudadNacimiento << "\n";
-    std::cout << "   - Fecha de nacimiento: " << fechaNacimiento << "\n\n";
+    std::cout << "[" << id << "] Nombre: " << textoNombre() << " " << textoApellido() << "\n";
+    std::cout << "   - Ciudad de nacimiento: " << textoCiudad() << "\n";
+    std::cout << "   - Fecha de nacimiento: " << textoFecha() << "\n\n";
     std::cout << std::fixed << std::setprecision(2);
     std::cout << "   - Ingresos anuales: $" << ingresosAnuales << "\n";
     std::cout << "   - Patrimonio: $" << patrimonio << "\n";
@@ -40,9 +60,22 @@ inline void Persona::mostrar() const {
 }
 
 inline void Persona::mostrarResumen() const {
-    std::cout << "[" << id << "] " << nombre << " " << apellido
-              << " | " << ciudadNacimiento 
+    std::cout << "[" << id << "] " << textoNombre() << " " << textoApellido()
+              << " | " << textoCiudad() 
               << " | $" << std::fixed << std::setprecision(2) << ingresosAnuales;
 }
 
+inline void Persona::formatearResumen(BufferTexto& salida) const {
+    salida.agregar('[');
+    salida.agregarEntero(id);
+    salida.agregar("] ");
+    salida.agregar(textoNombre());
+    salida.agregar(' ');
+    salida.agregar(textoApellido());
+    salida.agregar(" | ");
+    salida.agregar(textoCiudad());
+    salida.agregar(" | $");
+    salida.agregarDecimal2(ingresosAnuales);
+}
+
 #endif // PERSONA_H
\ No newline at end of file